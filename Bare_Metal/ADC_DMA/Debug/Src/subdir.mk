@@ -5,19 +5,37 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Src/flash.c \
+../Src/i2c_slave.c \
+../Src/irq.c \
+../Src/kv.c \
 ../Src/main.c \
+../Src/ramfunc.c \
 ../Src/syscalls.c \
-../Src/sysmem.c 
+../Src/sysmem.c \
+../Src/system.c 
 
 OBJS += \
+./Src/flash.o \
+./Src/i2c_slave.o \
+./Src/irq.o \
+./Src/kv.o \
 ./Src/main.o \
+./Src/ramfunc.o \
 ./Src/syscalls.o \
-./Src/sysmem.o 
+./Src/sysmem.o \
+./Src/system.o 
 
 C_DEPS += \
+./Src/flash.d \
+./Src/i2c_slave.d \
+./Src/irq.d \
+./Src/kv.d \
 ./Src/main.d \
+./Src/ramfunc.d \
 ./Src/syscalls.d \
-./Src/sysmem.d 
+./Src/sysmem.d \
+./Src/system.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -27,7 +45,7 @@ Src/%.o Src/%.su Src/%.cyclo: ../Src/%.c Src/subdir.mk
 clean: clean-Src
 
 clean-Src:
-	-$(RM) ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su
+	-$(RM) ./Src/flash.cyclo ./Src/flash.d ./Src/flash.o ./Src/flash.su ./Src/i2c_slave.cyclo ./Src/i2c_slave.d ./Src/i2c_slave.o ./Src/i2c_slave.su ./Src/irq.cyclo ./Src/irq.d ./Src/irq.o ./Src/irq.su ./Src/kv.cyclo ./Src/kv.d ./Src/kv.o ./Src/kv.su ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/ramfunc.cyclo ./Src/ramfunc.d ./Src/ramfunc.o ./Src/ramfunc.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su ./Src/system.cyclo ./Src/system.d ./Src/system.o ./Src/system.su
 
 .PHONY: clean-Src
 
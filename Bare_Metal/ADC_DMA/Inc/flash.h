@@ -0,0 +1,19 @@
+#ifndef FLASH_H_
+#define FLASH_H_
+
+#include "stdint.h"
+
+/*
+ * Gravacao da flash interna (usada pelo kv.c). Retornam 0 ou -1.
+ *
+ * O F103 so grava meias-palavras apagadas (0xFFFF). Enquanto a flash grava ou apaga, a CPU para na proxima busca
+ * de instrucao na flash; as interrupcoes do escravo I2C continuam sendo atendidas porque a tabela de vetores e os
+ * tratadores estao na SRAM (ramfunc.h).
+ * */
+
+void flash_unlock(void);
+void flash_lock(void);
+int flash_erase_page(uint32_t addr);
+int flash_program(uint32_t addr, const void *data, uint32_t length);
+
+#endif /* FLASH_H_ */
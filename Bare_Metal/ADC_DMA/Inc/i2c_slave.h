@@ -0,0 +1,44 @@
+#ifndef I2C_SLAVE_H_
+#define I2C_SLAVE_H_
+
+#include "stdint.h"
+
+/* Endereco de 7 bits do Blue Pill no barramento do MCU hospedeiro (I2C1: PB6 = SCL, PB7 = SDA) */
+#define I2C_SLAVE_ADDR			0x42
+
+/*
+ * Mapa de registradores (little-endian). Uma leitura comeca no registrador enviado na fase de escrita e o ponteiro
+ * avanca sozinho a cada byte; o mapa inteiro vem sempre da mesma copia, entao nunca mistura duas atualizacoes.
+ * Apenas os registradores de duty e de limiar sao escritos pelo mestre.
+ * */
+#define I2C_SLAVE_REG_ID		0x00	// 1 byte, fixo em I2C_SLAVE_ID
+#define I2C_SLAVE_REG_STATUS	0x01	// 1 byte, bits I2C_SLAVE_ST_*
+#define I2C_SLAVE_REG_SEQ		0x02	// 2 bytes, incrementa a cada i2c_slave_publish()
+#define I2C_SLAVE_REG_ADC		0x04	// 3 x 2 bytes: PA1, PA4, PA2
+#define I2C_SLAVE_REG_PWM		0x0A	// 3 x 2 bytes: duty de CH2, CH3, CH4 do TIM3 (leitura/escrita)
+#define I2C_SLAVE_REG_PUBLISH	0x10	// 4 bytes, quantidade de atualizacoes do mapa
+#define I2C_SLAVE_REG_READS		0x14	// 4 bytes, leituras atendidas
+#define I2C_SLAVE_REG_WRITES	0x18	// 4 bytes, escritas aceitas
+#define I2C_SLAVE_REG_ERRORS	0x1C	// 4 bytes, erros de barramento (BERR/OVR) e escritas rejeitadas
+#define I2C_SLAVE_REG_LIMIAR	0x20	// 3 x 2 bytes: limiares de PA1, PA4, PA2 (leitura/escrita, guardados na flash)
+#define I2C_SLAVE_REG_BOOT_US	0x26	// 4 bytes, tempo do reset ate main em us (boot_time_us(), fixo)
+#define I2C_SLAVE_REG_RAMFUNC	0x2A	// 2 bytes, SRAM do codigo relocado + 2 bytes, SRAM da tabela de vetores (fixos)
+#define I2C_SLAVE_REG_RAMFUNC_N	0x2E	// 1 byte, funcoes registradas com RAMFUNC_STAT() (fixo)
+#define I2C_SLAVE_REG_RAMFUNC_MAX	0x30	// 8 x 2 bytes: maior tempo em ciclos de cada funcao, na ordem de ramfunc_report()
+#define I2C_SLAVE_MAP_SIZE		64		// potencia de 2; 0x2F le zero
+
+/* Tempos de RAMFUNC_MAX no mapa: ficam em zero sem RAMFUNC_PROFILE (ramfunc.h) e saturam em 0xFFFF ciclos */
+#define I2C_SLAVE_RAMFUNC_SLOTS	8
+
+#define I2C_SLAVE_ID			0xB1
+
+#define I2C_SLAVE_ST_ADC		(1U<<0)	// o mapa ja tem uma leitura do ADC
+#define I2C_SLAVE_ST_PWM		(1U<<1)	// o mestre escreveu duties ainda nao aplicados
+#define I2C_SLAVE_ST_LIMIAR		(1U<<2)	// o mestre escreveu limiares ainda nao aplicados
+
+void i2c_slave_init(void);
+void i2c_slave_publish(const uint16_t adc[3], const uint16_t pwm[3], const uint16_t limiar[3]);
+int i2c_slave_take_pwm(uint16_t pwm[3]);
+int i2c_slave_take_limiar(uint16_t limiar[3]);
+
+#endif /* I2C_SLAVE_H_ */
@@ -0,0 +1,51 @@
+#ifndef IRQ_H_
+#define IRQ_H_
+
+#include "stdint.h"
+#include "stddef.h"
+#include "stm32f1xx.h"
+
+/*
+ * Tratadores de interrupcao instalados em tempo de execucao.
+ *
+ * O Reset_Handler copia a tabela de vetores para a SRAM (.ram_vector) e aponta o VTOR para ela (ramfunc.h). A
+ * partir dai irq_install() troca a entrada da propria tabela: o hardware salta direto para o tratador instalado, sem
+ * tratador intermediario nem chamada extra. Cada IRQ tem tambem um ponteiro de contexto, lido pelo tratador com um
+ * unico acesso a memoria: irq_context(n) quando o tratador sabe qual IRQ atende, irq_self() quando o mesmo codigo
+ * atende varias instancias (le o IPSR).
+ *
+ * Os tratadores ligados pelo nome no startup (I2C1_EV_IRQHandler etc.) continuam valendo ate serem substituidos, e
+ * irq_uninstall() devolve a entrada original da flash.
+ *
+ * irq_install(), irq_uninstall() e irq_handler() devolvem NULL, sem mexer na tabela, para um IRQn que nao existe no
+ * F103xB; com o depurador conectado param antes em um BKPT.
+ * */
+
+/*
+ * Interrupcoes externas que existem no STM32F103xB (0 a USBWakeUp_IRQn = 42). A tabela do startup tem as 60 entradas
+ * da linha de alta densidade; as de 43 em diante nunca disparam neste chip e nao sao aceitas por irq_install().
+ * */
+#define IRQ_COUNT			((uint32_t)USBWakeUp_IRQn+1U)
+#define IRQ_EXCEPTIONS		16U		// entradas da tabela antes da IRQ 0
+
+typedef void (*irq_handler_t)(void);
+
+extern void *volatile irq_ctx[IRQ_COUNT];
+
+irq_handler_t irq_install(IRQn_Type irq, irq_handler_t handler, void *ctx);
+irq_handler_t irq_uninstall(IRQn_Type irq);
+irq_handler_t irq_handler(IRQn_Type irq);
+
+/* Contexto da IRQ irq (somente interrupcoes externas) */
+__STATIC_FORCEINLINE void *irq_context(IRQn_Type irq)
+{
+	return irq_ctx[irq];
+}
+
+/* Contexto da interrupcao em atendimento; so pode ser chamado de dentro de um tratador de IRQ externa */
+__STATIC_FORCEINLINE void *irq_self(void)
+{
+	return irq_ctx[__get_IPSR()-IRQ_EXCEPTIONS];
+}
+
+#endif /* IRQ_H_ */
@@ -0,0 +1,55 @@
+#ifndef KV_H_
+#define KV_H_
+
+#include "stdint.h"
+#include "stm32f1xx.h"
+
+/*
+ * Configuracao persistente na flash (emulacao de EEPROM), nas 4 ultimas paginas (regiao KV do linker).
+ *
+ * Cada kv_set() acrescenta um registro ao fim do banco ativo; o valor mais recente de cada chave fica numa copia na
+ * RAM (kv_cache), entao as leituras nao tocam a flash e podem ficar em caminhos quentes: kv_get_u16() e um acesso a
+ * memoria e uma comparacao. Detalhes do formato e da coleta de lixo em kv.c.
+ * */
+
+#define KV_KEYS				16U			// chaves de 0 a KV_KEYS-1
+#define KV_VALUE_MAX		16U			// bytes por valor
+#define KV_ABSENT			0xFFFFU		// kv_cache[].len de uma chave sem valor
+
+/* Chaves em uso. Os numeros ficam gravados na flash: nao reaproveitar nem renumerar. */
+#define KV_KEY_LIMIAR1		1U			// uint16_t, limiar do canal 1 (PA1)
+#define KV_KEY_LIMIAR2		2U			// uint16_t, limiar do canal 4 (PA4)
+#define KV_KEY_LIMIAR3		3U			// uint16_t, limiar do canal 2 (PA2)
+
+typedef struct
+{
+	uint16_t len;
+	union
+	{
+		uint8_t b[KV_VALUE_MAX];
+		uint16_t u16[KV_VALUE_MAX/2U];
+		uint32_t u32[KV_VALUE_MAX/4U];
+	} v;
+} kv_entry_t;
+
+extern kv_entry_t kv_cache[KV_KEYS];
+
+int kv_init(void);
+int kv_get(uint16_t key, void *data, uint16_t size);
+int kv_set(uint16_t key, const void *data, uint16_t len);
+int kv_delete(uint16_t key);
+uint32_t kv_free(void);
+uint32_t kv_generation(void);
+
+/* Valor de 16 bits da chave key, ou def se ela nao existe ou tem outro tamanho */
+__STATIC_FORCEINLINE uint16_t kv_get_u16(uint16_t key, uint16_t def)
+{
+	return (kv_cache[key].len==2U)?kv_cache[key].v.u16[0]:def;
+}
+
+__STATIC_INLINE int kv_set_u16(uint16_t key, uint16_t value)
+{
+	return kv_set(key,&value,2U);
+}
+
+#endif /* KV_H_ */
@@ -0,0 +1,28 @@
+#ifndef PINS_H_
+#define PINS_H_
+
+#include "gpio.h"
+
+/* Entradas analogicas do ADC1, na ordem da sequencia de conversao */
+#define PIN_ADC_CH1		(A, 1, GPIO_IN_ANALOG)
+#define PIN_ADC_CH4		(A, 4, GPIO_IN_ANALOG)
+#define PIN_ADC_CH2		(A, 2, GPIO_IN_ANALOG)
+
+/* LEDs acesos quando o canal correspondente passa do limiar */
+#define PIN_LED1		(B, 8, GPIO_OUT_PP_2MHZ)
+#define PIN_LED2		(B, 9, GPIO_OUT_PP_2MHZ)
+#define PIN_LED3		(B, 10, GPIO_OUT_PP_2MHZ)
+
+/* Saidas PWM do TIM3 sem remapeamento: CH2 = PA7, CH3 = PB0, CH4 = PB1 */
+#define PIN_PWM_R		(A, 7, GPIO_AF_PP_50MHZ)
+#define PIN_PWM_G		(B, 0, GPIO_AF_PP_50MHZ)
+#define PIN_PWM_B		(B, 1, GPIO_AF_PP_50MHZ)
+
+/* I2C1 escravo (i2c_slave.c) */
+#define PIN_I2C_SCL		(B, 6, GPIO_AF_OD_50MHZ)
+#define PIN_I2C_SDA		(B, 7, GPIO_AF_OD_50MHZ)
+
+GPIO_ASSERT_DISTINCT(PIN_ADC_CH1, PIN_ADC_CH4, PIN_ADC_CH2, PIN_LED1, PIN_LED2, PIN_LED3,
+		PIN_PWM_R, PIN_PWM_G, PIN_PWM_B, PIN_I2C_SCL, PIN_I2C_SDA);
+
+#endif /* PINS_H_ */
@@ -0,0 +1,88 @@
+#ifndef RAMFUNC_H_
+#define RAMFUNC_H_
+
+#include "stdint.h"
+#include "stm32f1xx.h"
+
+/*
+ * Codigo executado da SRAM.
+ *
+ * A 72 MHz a flash precisa de 2 wait states; o prefetch so esconde isso em codigo linear. Uma ISR cheia de desvios
+ * perde ate 2 ciclos a cada desvio tomado. Funcoes marcadas com RAMFUNC vao para a secao .ramfunc, copiada para a
+ * SRAM pelo Reset_Handler junto com o .data, e rodam sem wait states. A tabela de vetores tambem e copiada para a
+ * SRAM (.ram_vector) e o VTOR aponta para ela antes de main.
+ *
+ * O custo e RAM: cada funcao ocupa o seu tamanho em flash (imagem de carga) e de novo em SRAM. Para decidir o que
+ * vale a pena mover, cada funcao relocada e registrada com RAMFUNC_STAT() e ramfunc_init() calcula quantos bytes
+ * de SRAM ela ocupa. As que tambem usam RAMFUNC_ENTER()/RAMFUNC_LEAVE() acumulam os ciclos gastos (DWT). Compilando
+ * com -DRAMFUNC_ENABLE=0 as mesmas funcoes ficam na flash e a tabela mostra os ciclos de la: a diferenca de
+ * min/ciclos por chamada entre as duas compilacoes e a economia, e bytes e o preco. A medida custa dois acessos ao
+ * DWT e quatro atualizacoes por chamada, entao so e compilada com -DRAMFUNC_PROFILE=1; os maiores tempos aparecem no
+ * mapa do escravo I2C (I2C_SLAVE_REG_RAMFUNC_MAX).
+ *
+ * Todo RAMFUNC precisa de um RAMFUNC_STAT: o tamanho e a distancia ate a proxima funcao registrada (ou ate o fim
+ * da secao), entao uma funcao nao registrada seria contada na anterior.
+ * */
+
+#ifndef RAMFUNC_ENABLE
+#define RAMFUNC_ENABLE			1
+#endif
+
+#ifndef RAMFUNC_PROFILE
+#define RAMFUNC_PROFILE			0
+#endif
+
+/*
+ * long_call: a SRAM fica a 384 MB da flash, fora do alcance do BL (+-16 MB); a chamada passa a ser por registrador
+ * nos dois sentidos, sem veneer do linker rodando da flash. noinline: a -O0 nada e inlinado, mas com otimizacao uma
+ * funcao pequena voltaria para dentro de quem a chama.
+ * */
+#if RAMFUNC_ENABLE
+#define RAMFUNC					__attribute__((section(".ramfunc"),long_call,noinline))
+#else
+#define RAMFUNC
+#endif
+
+typedef struct
+{
+	const char *name;
+	void (*fn)(void);
+	uint32_t bytes;				// SRAM ocupada (0 se a funcao ficou na flash)
+	uint32_t calls;
+	uint32_t cycles;			// total, do RAMFUNC_ENTER ao RAMFUNC_LEAVE
+	uint32_t min;
+	uint32_t max;
+} ramfunc_stat_t;
+
+/*
+ * Registra uma funcao relocada na tabela .ramfunc_stats (dentro do .data). A funcao precisa estar declarada antes;
+ * o registro define fn##_stat, usado por RAMFUNC_ENTER/RAMFUNC_LEAVE.
+ * */
+#define RAMFUNC_STAT(fn) \
+	static ramfunc_stat_t fn##_stat __attribute__((section(".ramfunc_stats"),used))={#fn,(void (*)(void))fn,0,0,0,0xFFFFFFFFUL,0}
+
+/* Mede do ENTER ao LEAVE; a conta e feita aqui mesmo (sem chamada), entao roda onde a funcao medida roda */
+#if RAMFUNC_PROFILE
+#define RAMFUNC_ENTER(fn) \
+	uint32_t fn##_t0=DWT->CYCCNT
+
+#define RAMFUNC_LEAVE(fn) \
+	do \
+	{ \
+		uint32_t fn##_dt=DWT->CYCCNT-fn##_t0; \
+		fn##_stat.calls++; \
+		fn##_stat.cycles+=fn##_dt; \
+		if(fn##_dt<fn##_stat.min) fn##_stat.min=fn##_dt; \
+		if(fn##_dt>fn##_stat.max) fn##_stat.max=fn##_dt; \
+	} while(0)
+#else
+#define RAMFUNC_ENTER(fn)
+#define RAMFUNC_LEAVE(fn)		do {} while(0)
+#endif
+
+void ramfunc_init(void);
+uint32_t ramfunc_report(const ramfunc_stat_t **table);
+uint32_t ramfunc_code_bytes(void);
+uint32_t ramfunc_vector_bytes(void);
+
+#endif /* RAMFUNC_H_ */
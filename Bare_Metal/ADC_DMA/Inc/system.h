@@ -0,0 +1,29 @@
+#ifndef SYSTEM_H_
+#define SYSTEM_H_
+
+#include "stdint.h"
+#include "stm32f1xx.h"
+
+/*
+ * Clock: HSE de 8 MHz x 9 = 72 MHz (2 wait states), APB1 = 36 MHz, APB2 = 72 MHz, ADC = 72/6 = 12 MHz.
+ * Se o cristal nao partir em SYSTEM_HSE_TIMEOUT voltas, usa HSI/2 x 16 = 64 MHz com os mesmos divisores.
+ * SystemCoreClock so e valido depois de SystemCoreClockUpdate() (chamada no inicio de main).
+ * */
+#define SYSTEM_HSE_HZ			8000000UL
+#define SYSTEM_HSI_HZ			8000000UL
+#define SYSTEM_HSE_TIMEOUT		0x5000U
+
+/* APB1 e sempre SYSCLK/2; os timers do APB1 recebem 2 x PCLK1 = SYSCLK */
+#define SYSTEM_PCLK1_HZ			(SystemCoreClock/2U)
+#define SYSTEM_TIM_APB1_HZ		(SystemCoreClock)
+
+/* Variaveis que sobrevivem a um reset a quente: nao sao zeradas nem inicializadas pelo startup */
+#define NOINIT					__attribute__((section(".noinit")))
+
+/* Ciclos do DWT do reset ate a troca de clock (a 8 MHz) e ate a entrada em main (gravados pelo startup) */
+extern uint32_t boot_clock_cycles;
+extern uint32_t boot_cycles;
+
+uint32_t boot_time_us(void);
+
+#endif /* SYSTEM_H_ */
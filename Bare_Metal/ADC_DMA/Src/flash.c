@@ -0,0 +1,76 @@
+#include "flash.h"
+#include "stm32f1xx.h"
+
+/*
+ * Interface da flash do F103 (RM0008, PM0075). Cada meia-palavra leva ~50 us e uma pagina ~20 ms; durante esse
+ * tempo a CPU fica parada na busca de instrucoes (o codigo roda da mesma flash), mas o DMA continua: o ADC segue
+ * atualizando adcValues. O HSI precisa estar ligado.
+ * */
+
+void flash_unlock(void)
+{
+	if(FLASH->CR&FLASH_CR_LOCK)
+	{
+		FLASH->KEYR=FLASH_KEY1;
+		FLASH->KEYR=FLASH_KEY2;
+	}
+}
+
+void flash_lock(void)
+{
+	FLASH->CR|=FLASH_CR_LOCK;
+}
+
+/* Espera o fim da operacao e devolve -1 em erro de gravacao ou de protecao */
+static int flash_wait(void)
+{
+	uint32_t sr;
+
+	while(FLASH->SR&FLASH_SR_BSY);
+	sr=FLASH->SR;
+	FLASH->SR=FLASH_SR_EOP|FLASH_SR_PGERR|FLASH_SR_WRPRTERR;
+	return (sr&(FLASH_SR_PGERR|FLASH_SR_WRPRTERR))?-1:0;
+}
+
+/* Apaga a pagina de 1 KB que contem addr e confere que ficou toda em 0xFF */
+int flash_erase_page(uint32_t addr)
+{
+	int err;
+
+	FLASH->CR|=FLASH_CR_PER;
+	FLASH->AR=addr;
+	FLASH->CR|=FLASH_CR_STRT;
+	err=flash_wait();
+	FLASH->CR&=~FLASH_CR_PER;
+
+	const uint32_t *p=(const uint32_t *)(addr&~1023UL);
+	for(uint32_t i=0;i<1024U/4U && !err;i++)
+	{
+		if(p[i]!=0xFFFFFFFFUL)
+		{
+			err=-1;
+		}
+	}
+	return err;
+}
+
+/* Grava length bytes (arredondado para cima em meias-palavras, o byte extra vem de data) e confere a leitura */
+int flash_program(uint32_t addr, const void *data, uint32_t length)
+{
+	const uint16_t *src=data;
+	volatile uint16_t *dst=(volatile uint16_t *)addr;
+	int err=0;
+
+	FLASH->CR|=FLASH_CR_PG;
+	for(uint32_t i=0;i<(length+1U)/2U && !err;i++)
+	{
+		dst[i]=src[i];
+		err=flash_wait();
+		if(!err && dst[i]!=src[i])
+		{
+			err=-1;
+		}
+	}
+	FLASH->CR&=~FLASH_CR_PG;
+	return err;
+}
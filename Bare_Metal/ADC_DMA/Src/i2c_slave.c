@@ -0,0 +1,321 @@
+#include "i2c_slave.h"
+#include "stm32f1xx.h"
+#include "pins.h"
+#include "system.h"
+#include "ramfunc.h"
+#include "irq.h"
+#include "string.h"
+
+/*
+ * I2C1 como escravo do MCU hospedeiro.
+ *
+ * O mestre escreve o numero do registrador e, com START repetido, le quantos bytes quiser a partir dele. Para atender
+ * a 400 kHz sem esticar o SCL (NOSTRETCH) o byte seguinte precisa estar no DR antes do primeiro pulso de clock, entao
+ * a transmissao e feita pelo DMA1 canal 6: assim que o ponteiro de registrador chega (RXNE) o canal ja e armado
+ * apontando para a copia mais recente do mapa, e o proprio pedido do TXE abastece o DR sem passar pela CPU.
+ *
+ * O mapa e mantido em tres copias. i2c_slave_publish() sempre escreve em uma copia que nao e a ultima publicada nem a
+ * que esta reservada para a leitura em curso, e so depois troca o indice "front". A interrupcao reserva a copia
+ * "front" no momento em que arma o DMA, entao uma leitura do mapa inteiro nunca mistura duas atualizacoes e nenhum dos
+ * lados precisa desabilitar interrupcoes.
+ *
+ * Escritas do mestre (somente nos registradores de duty ou de limiar) vao para uma area de rascunho e so sao aceitas
+ * no STOP, inteiras: uma escrita de varios bytes nunca e aplicada pela metade.
+ * */
+
+/* Clock do APB1 em MHz (CR2.FREQ): 36 com o cristal, 32 no HSI (system.c); no modo rapido o minimo e 4 MHz */
+#define I2C_SLAVE_PCLK1_MHZ		(SYSTEM_PCLK1_HZ/1000000UL)
+
+static uint8_t map[3][I2C_SLAVE_MAP_SIZE];
+static volatile uint8_t front;			// ultima copia publicada
+static volatile uint8_t reading;			// copia reservada pela interrupcao para a leitura armada
+static uint16_t seq;
+static uint32_t publish_count;
+
+static volatile uint8_t reg_ptr;
+static uint8_t rx_count;
+static uint8_t stage[I2C_SLAVE_MAP_SIZE];
+
+/* Grupo de tres registradores de 16 bits que o mestre pode escrever */
+typedef struct
+{
+	uint8_t reg;						// primeiro registrador do grupo
+	uint8_t status;						// bit de STATUS enquanto a escrita nao foi aplicada
+	volatile uint8_t pending;
+	volatile uint16_t req[3];
+} i2c_slave_wr_t;
+
+static i2c_slave_wr_t wr_pwm={I2C_SLAVE_REG_PWM,I2C_SLAVE_ST_PWM,0,{0}};
+static i2c_slave_wr_t wr_limiar={I2C_SLAVE_REG_LIMIAR,I2C_SLAVE_ST_LIMIAR,0,{0}};
+
+static volatile uint32_t read_count;
+static volatile uint32_t write_count;
+static volatile uint32_t error_count;
+
+/*
+ * Todo o caminho das interrupcoes roda da SRAM (ramfunc.h): a cada byte recebido e a cada STOP/NACK o EV/ER passa
+ * por varios desvios, e a 72 MHz cada desvio tomado na flash custa 2 wait states.
+ * */
+static RAMFUNC void i2c_slave_arm_tx(uint8_t reg);
+static RAMFUNC void i2c_slave_config(void);
+static RAMFUNC void i2c_slave_commit(uint8_t n);
+static RAMFUNC void i2c_slave_ev_irq(void);
+static RAMFUNC void i2c_slave_er_irq(void);
+
+RAMFUNC_STAT(i2c_slave_arm_tx);
+RAMFUNC_STAT(i2c_slave_config);
+RAMFUNC_STAT(i2c_slave_commit);
+RAMFUNC_STAT(i2c_slave_ev_irq);
+RAMFUNC_STAT(i2c_slave_er_irq);
+
+static void put16(uint8_t *p, uint16_t v)
+{
+	p[0]=(uint8_t)v;
+	p[1]=(uint8_t)(v>>8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+	put16(p,(uint16_t)v);
+	put16(p+2,(uint16_t)(v>>16));
+}
+
+/* Arma o DMA de transmissao a partir do registrador reg da copia mais recente */
+static void i2c_slave_arm_tx(uint8_t reg)
+{
+	DMA1_Channel6->CCR&=~DMA_CCR_EN;
+	reading=front;
+	DMA1_Channel6->CMAR=(uint32_t)&map[reading][reg];
+	DMA1_Channel6->CNDTR=I2C_SLAVE_MAP_SIZE-reg;
+	DMA1_Channel6->CCR|=DMA_CCR_EN;
+}
+
+static void i2c_slave_config(void)
+{
+	I2C1->CR1=I2C_CR1_SWRST;
+	I2C1->CR1=0;
+	I2C1->CR2=I2C_SLAVE_PCLK1_MHZ|I2C_CR2_ITEVTEN|I2C_CR2_ITERREN|I2C_CR2_DMAEN;
+	I2C1->OAR1=(1U<<14)|(I2C_SLAVE_ADDR<<1);		// o bit 14 deve ser mantido em 1 (RM0008)
+	I2C1->CR1=I2C_CR1_PE;
+	I2C1->CR1|=I2C_CR1_ACK|I2C_CR1_NOSTRETCH;		// ACK so tem efeito com PE=1
+	rx_count=0;
+	i2c_slave_arm_tx(reg_ptr);
+}
+
+void i2c_slave_init(void)
+{
+	RCC->APB1ENR|=RCC_APB1ENR_I2C1EN;
+	RCC->AHBENR|=RCC_AHBENR_DMA1EN;
+
+	// PB6 (SCL) e PB7 (SDA): saida alternativa dreno aberto, 50 MHz
+	GPIO_CONFIG(B,PIN_I2C_SCL,PIN_I2C_SDA);
+
+	// Registradores que nao mudam depois do boot vao direto para as tres copias
+	uint32_t boot_us=boot_time_us();
+	const ramfunc_stat_t *rf;
+	uint32_t rf_n=ramfunc_report(&rf);
+	memset(map,0,sizeof(map));
+	for(uint8_t i=0;i<3;i++)
+	{
+		map[i][I2C_SLAVE_REG_ID]=I2C_SLAVE_ID;
+		put32(&map[i][I2C_SLAVE_REG_BOOT_US],boot_us);
+		put16(&map[i][I2C_SLAVE_REG_RAMFUNC],(uint16_t)ramfunc_code_bytes());
+		put16(&map[i][I2C_SLAVE_REG_RAMFUNC+2],(uint16_t)ramfunc_vector_bytes());
+		map[i][I2C_SLAVE_REG_RAMFUNC_N]=(uint8_t)rf_n;
+	}
+	front=0;
+	reading=0;
+	reg_ptr=0;
+
+	// DMA1 canal 6 = I2C1_TX: memoria -> DR, 8 bits, incrementa a memoria, prioridade muito alta
+	DMA1_Channel6->CCR=0;
+	DMA1_Channel6->CPAR=(uint32_t)&I2C1->DR;
+	DMA1_Channel6->CCR=DMA_CCR_DIR|DMA_CCR_MINC|DMA_CCR_PL;
+
+	i2c_slave_config();
+
+	// Os tratadores sao instalados na tabela de vetores da SRAM (irq.h), direto, sem passar pelos nomes do startup
+	irq_install(I2C1_EV_IRQn,i2c_slave_ev_irq,NULL);
+	irq_install(I2C1_ER_IRQn,i2c_slave_er_irq,NULL);
+
+	// Sem clock stretching os prazos sao de um bit: as interrupcoes do I2C ficam acima de todas as outras
+	NVIC_SetPriority(I2C1_EV_IRQn,0);
+	NVIC_SetPriority(I2C1_ER_IRQn,0);
+	NVIC_EnableIRQ(I2C1_EV_IRQn);
+	NVIC_EnableIRQ(I2C1_ER_IRQn);
+}
+
+/*
+ * Atualiza o mapa com o bloco do ADC e os duties em uso. Chamada apenas do laco principal; a copia fica visivel
+ * para o mestre na proxima leitura que enviar o ponteiro de registrador.
+ * */
+void i2c_slave_publish(const uint16_t adc[3], const uint16_t pwm[3], const uint16_t limiar[3])
+{
+	uint8_t r=reading;
+	uint8_t b=0;
+	while(b==front || b==r)
+	{
+		b++;
+	}
+
+	uint8_t *m=map[b];
+	m[I2C_SLAVE_REG_STATUS]=I2C_SLAVE_ST_ADC|(wr_pwm.pending?wr_pwm.status:0)|(wr_limiar.pending?wr_limiar.status:0);
+	put16(&m[I2C_SLAVE_REG_SEQ],++seq);
+	for(uint8_t i=0;i<3;i++)
+	{
+		put16(&m[I2C_SLAVE_REG_ADC+2*i],adc[i]);
+		put16(&m[I2C_SLAVE_REG_PWM+2*i],pwm[i]);
+		put16(&m[I2C_SLAVE_REG_LIMIAR+2*i],limiar[i]);
+	}
+	put32(&m[I2C_SLAVE_REG_PUBLISH],++publish_count);
+	put32(&m[I2C_SLAVE_REG_READS],read_count);
+	put32(&m[I2C_SLAVE_REG_WRITES],write_count);
+	put32(&m[I2C_SLAVE_REG_ERRORS],error_count);
+
+	// Maior tempo de cada funcao relocada (ramfunc.h); o max e atualizado pela interrupcao em uma escrita de 32 bits
+	const ramfunc_stat_t *rf;
+	uint32_t rf_n=ramfunc_report(&rf);
+	for(uint32_t i=0;i<rf_n && i<I2C_SLAVE_RAMFUNC_SLOTS;i++)
+	{
+		uint32_t max=rf[i].max;
+		put16(&m[I2C_SLAVE_REG_RAMFUNC_MAX+2*i],(uint16_t)(max>0xFFFFU?0xFFFFU:max));
+	}
+
+	__DMB();
+	front=b;
+}
+
+/* Copia os valores escritos pelo mestre no grupo w. Retorna 1 se havia uma escrita nova, 0 caso contrario. */
+static int i2c_slave_take(i2c_slave_wr_t *w, uint16_t v[3])
+{
+	if(!w->pending)
+	{
+		return 0;
+	}
+	NVIC_DisableIRQ(I2C1_EV_IRQn);
+	for(uint8_t i=0;i<3;i++)
+	{
+		v[i]=w->req[i];
+	}
+	w->pending=0;
+	NVIC_EnableIRQ(I2C1_EV_IRQn);
+	return 1;
+}
+
+int i2c_slave_take_pwm(uint16_t pwm[3])
+{
+	return i2c_slave_take(&wr_pwm,pwm);
+}
+
+int i2c_slave_take_limiar(uint16_t limiar[3])
+{
+	return i2c_slave_take(&wr_limiar,limiar);
+}
+
+/* Aceita a escrita de n bytes em [reg_ptr, reg_ptr+n) se ela cobrir apenas valores inteiros de um grupo */
+static void i2c_slave_commit(uint8_t n)
+{
+	uint8_t lo=reg_ptr;
+	uint8_t hi=lo+n;
+	i2c_slave_wr_t *w=(lo>=I2C_SLAVE_REG_LIMIAR)?&wr_limiar:&wr_pwm;
+
+	if(lo<w->reg || hi>w->reg+6 || ((lo-w->reg)|n)&1)
+	{
+		error_count++;
+		return;
+	}
+	if(!w->pending)
+	{
+		// Os valores nao escritos continuam com o valor publicado
+		const uint8_t *m=&map[front][w->reg];
+		for(uint8_t i=0;i<3;i++)
+		{
+			w->req[i]=(uint16_t)(m[2*i]|(m[2*i+1]<<8));
+		}
+	}
+	for(uint8_t r=lo;r<hi;r+=2)
+	{
+		w->req[(r-w->reg)/2]=(uint16_t)(stage[r]|(stage[r+1]<<8));
+	}
+	w->pending=1;
+	write_count++;
+}
+
+static void i2c_slave_ev_irq(void)
+{
+	RAMFUNC_ENTER(i2c_slave_ev_irq);
+	uint32_t sr1=I2C1->SR1;
+
+	if(sr1&I2C_SR1_ADDR)
+	{
+		// ADDR so e apagado pela leitura de SR1 seguida de SR2
+		if(I2C1->SR2&I2C_SR2_TRA)
+		{
+			// O DMA ja foi armado; o TXE nao precisa gerar interrupcao
+			I2C1->CR2&=~I2C_CR2_ITBUFEN;
+		}
+		else
+		{
+			rx_count=0;
+			I2C1->CR2|=I2C_CR2_ITBUFEN;
+		}
+	}
+
+	if(sr1&I2C_SR1_RXNE)
+	{
+		uint8_t byte=(uint8_t)I2C1->DR;
+		if(rx_count==0)
+		{
+			reg_ptr=byte&(I2C_SLAVE_MAP_SIZE-1);
+			i2c_slave_arm_tx(reg_ptr);
+		}
+		else if(reg_ptr+rx_count-1<I2C_SLAVE_MAP_SIZE)
+		{
+			stage[reg_ptr+rx_count-1]=byte;
+		}
+		if(rx_count<0xFF)
+		{
+			rx_count++;
+		}
+	}
+
+	if(sr1&I2C_SR1_STOPF)
+	{
+		// STOPF e apagado pela leitura de SR1 seguida de uma escrita em CR1
+		I2C1->CR1|=I2C_CR1_PE;
+		I2C1->CR2&=~I2C_CR2_ITBUFEN;
+		if(rx_count>1)
+		{
+			i2c_slave_commit(rx_count-1);
+		}
+		rx_count=0;
+		i2c_slave_arm_tx(reg_ptr);
+	}
+	RAMFUNC_LEAVE(i2c_slave_ev_irq);
+}
+
+static void i2c_slave_er_irq(void)
+{
+	RAMFUNC_ENTER(i2c_slave_er_irq);
+	uint32_t sr1=I2C1->SR1;
+
+	if(sr1&(I2C_SR1_BERR|I2C_SR1_OVR))
+	{
+		// OVR tambem aparece quando o mestre le alem do fim do mapa (o ultimo byte e repetido)
+		error_count++;
+		I2C1->SR1=(uint16_t)~(I2C_SR1_BERR|I2C_SR1_OVR);
+	}
+
+	if(sr1&I2C_SR1_AF)
+	{
+		/*
+		 * NACK do mestre: fim normal de uma leitura. Nao ha STOPF para o escravo transmissor depois de um NACK, e o
+		 * DMA ja deixou o proximo byte no DR; o reset do periferico descarta esse byte e o DMA e rearmado no
+		 * registrador da ultima escrita.
+		 * */
+		read_count++;
+		I2C1->SR1=(uint16_t)~I2C_SR1_AF;
+		i2c_slave_config();
+	}
+	RAMFUNC_LEAVE(i2c_slave_er_irq);
+}
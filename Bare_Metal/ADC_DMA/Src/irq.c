@@ -0,0 +1,70 @@
+#include "irq.h"
+
+/* Tabela em SRAM (preenchida pelo startup) e a original na flash */
+extern irq_handler_t _sram_vector[];
+extern const irq_handler_t g_pfnVectors[];
+
+void *volatile irq_ctx[IRQ_COUNT];
+
+/*
+ * Numero de IRQ fora do chip (ou abaixo do NMI) e erro de programacao: o indice cairia em outra entrada da tabela ou
+ * fora do irq_ctx. Com o depurador conectado para no BKPT; sem ele o BKPT viraria HardFault, entao so e executado
+ * com C_DEBUGEN ligado e a chamada devolve NULL.
+ * */
+static int irq_valid(IRQn_Type irq)
+{
+	if(irq<NonMaskableInt_IRQn || irq>=(int32_t)IRQ_COUNT)
+	{
+		if(CoreDebug->DHCSR&CoreDebug_DHCSR_C_DEBUGEN_Msk)
+		{
+			__BKPT(0);
+		}
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ * Instala handler para irq (IRQn negativo = excecao do nucleo, como SysTick_IRQn; para essas ctx e ignorado) e
+ * devolve o tratador anterior. O contexto e gravado antes do vetor: uma interrupcao que ja esteja pendente e entre
+ * logo depois ja encontra o contexto novo. A troca de uma palavra e atomica, entao a IRQ nao precisa ser desligada.
+ * Devolve NULL, sem mexer na tabela, para uma IRQ que nao existe no F103xB.
+ * */
+irq_handler_t irq_install(IRQn_Type irq, irq_handler_t handler, void *ctx)
+{
+	if(!irq_valid(irq))
+	{
+		return NULL;
+	}
+
+	irq_handler_t *slot=&_sram_vector[IRQ_EXCEPTIONS+irq];
+	irq_handler_t old=*slot;
+
+	if(irq>=0)
+	{
+		irq_ctx[irq]=ctx;
+	}
+	__DSB();
+	*slot=handler;
+	__DSB();
+	return old;
+}
+
+/* Volta a entrada da flash (o tratador ligado pelo nome, ou Default_Handler) e zera o contexto */
+irq_handler_t irq_uninstall(IRQn_Type irq)
+{
+	if(!irq_valid(irq))
+	{
+		return NULL;
+	}
+	return irq_install(irq,g_pfnVectors[IRQ_EXCEPTIONS+irq],NULL);
+}
+
+irq_handler_t irq_handler(IRQn_Type irq)
+{
+	if(!irq_valid(irq))
+	{
+		return NULL;
+	}
+	return _sram_vector[IRQ_EXCEPTIONS+irq];
+}
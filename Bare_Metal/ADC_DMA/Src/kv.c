@@ -0,0 +1,293 @@
+#include "kv.h"
+#include "flash.h"
+#include "string.h"
+
+/*
+ * Armazenamento chave-valor em log, com troca de bancos.
+ *
+ * A regiao KV (4 KB) e dividida em dois bancos de duas paginas. O banco comeca com um cabecalho (geracao, KV_MAGIC)
+ * seguido de registros kv_rec_t, cada um com o valor completado com 0xFF ate multiplo de 4. Vale o banco com
+ * KV_MAGIC e a maior geracao; na partida o log inteiro e lido uma vez e o ultimo valor de cada chave fica em
+ * kv_cache. Um registro com tamanho 0 apaga a chave.
+ *
+ * Queda de energia:
+ * - o registro e gravado na ordem chave, tamanho, CRC, valor. Um registro interrompido fica com CRC errado e e
+ *   ignorado; se o proprio cabecalho ficou pela metade, o resto do banco e dado como cheio e a proxima escrita faz a
+ *   troca de banco;
+ * - na troca, o outro banco recebe o valor atual de cada chave (da RAM) e o registro novo, e so entao o cabecalho
+ *   com a geracao seguinte (KV_MAGIC por ultimo). Interrompida antes disso, o banco antigo continua valendo; depois,
+ *   o novo ja vale. O banco que deixou de valer e apagado logo em seguida, para que a proxima troca o encontre em
+ *   branco; as paginas que ainda nao estiverem em branco (apagamento interrompido) sao apagadas na propria troca.
+ *
+ * Desgaste: com registros de 12 bytes (valor de 16 bits) cada banco recebe ~170 escritas entre duas trocas. Um banco
+ * so e apagado quando deixa de valer, e kv_erase() pula as paginas ja em branco, entao cada pagina e apagada uma vez
+ * a cada duas trocas. kv_generation() conta as trocas. Escritas que nao mudam o valor nao gravam nada.
+ *
+ * O CRC e o da unidade de CRC do STM32, sobre a palavra chave|tamanho e as palavras do valor. So o laco principal
+ * usa a unidade de CRC e este modulo.
+ * */
+
+#define KV_MAGIC			0x4B565354UL	// "KVST"
+#define KV_PAGE_SIZE		1024U
+
+typedef struct
+{
+	uint32_t generation;
+	uint32_t magic;					// gravado por ultimo
+} kv_bank_t;
+
+typedef struct
+{
+	uint16_t key;
+	uint16_t len;
+	uint32_t crc;
+} kv_rec_t;
+
+/* Limites da regiao KV (linker) */
+extern uint8_t _skv[];
+extern uint8_t _ekv[];
+
+#define KV_BANK_SIZE		((uint32_t)(_ekv-_skv)/2U)
+#define KV_BANK(n)			((uint32_t)_skv+(uint32_t)(n)*KV_BANK_SIZE)
+#define KV_ALIGN4(n)		(((uint32_t)(n)+3U)&~3UL)
+
+kv_entry_t kv_cache[KV_KEYS];
+
+static uint8_t active;
+static uint32_t generation;
+static uint32_t wr;						// endereco do proximo registro no banco ativo
+
+static uint32_t kv_crc(uint32_t head, const uint32_t *data, uint32_t words)
+{
+	CRC->CR=CRC_CR_RESET;
+	CRC->DR=head;
+	for(uint32_t i=0;i<words;i++)
+	{
+		CRC->DR=data[i];
+	}
+	return CRC->DR;
+}
+
+/* 1 se a pagina em addr esta toda em 0xFF */
+static int kv_blank(uint32_t addr)
+{
+	const uint32_t *p=(const uint32_t *)addr;
+
+	for(uint32_t i=0;i<KV_PAGE_SIZE/4U;i++)
+	{
+		if(p[i]!=0xFFFFFFFFUL)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/* Apaga as paginas do banco que nao estao em branco (ler 1 KB custa bem menos que os ~20 ms de um apagamento) */
+static int kv_erase(uint8_t bank)
+{
+	for(uint32_t a=KV_BANK(bank);a<KV_BANK(bank)+KV_BANK_SIZE;a+=KV_PAGE_SIZE)
+	{
+		if(!kv_blank(a) && flash_erase_page(a)<0)
+		{
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/* Grava um registro em wr. Devolve -1 se ele nao cabe no banco ou a gravacao falhou. A flash deve estar destravada. */
+static int kv_append(uint16_t key, const void *data, uint16_t len)
+{
+	struct
+	{
+		kv_rec_t h;
+		uint32_t data[KV_VALUE_MAX/4U];
+	} r;
+	uint32_t size=sizeof(kv_rec_t)+KV_ALIGN4(len);
+
+	if(wr+size>KV_BANK(active)+KV_BANK_SIZE)
+	{
+		return -1;
+	}
+	memset(r.data,0xFF,sizeof(r.data));
+	memcpy(r.data,data,len);
+	r.h.key=key;
+	r.h.len=len;
+	r.h.crc=kv_crc(key|((uint32_t)len<<16),r.data,KV_ALIGN4(len)/4U);
+
+	int err=flash_program(wr,&r,size);
+	wr+=size;							// mesmo com erro: o espaco pode ter ficado gravado pela metade
+	return err;
+}
+
+/* Le o log do banco ativo para kv_cache e posiciona wr depois do ultimo registro */
+static void kv_scan(void)
+{
+	uint32_t end=KV_BANK(active)+KV_BANK_SIZE;
+
+	for(uint16_t k=0;k<KV_KEYS;k++)
+	{
+		kv_cache[k].len=KV_ABSENT;
+	}
+
+	wr=KV_BANK(active)+sizeof(kv_bank_t);
+	while(wr+sizeof(kv_rec_t)<=end)
+	{
+		const kv_rec_t *h=(const kv_rec_t *)wr;
+		if(h->key==0xFFFFU && h->len==0xFFFFU && h->crc==0xFFFFFFFFUL)
+		{
+			return;						// fim do log
+		}
+		uint32_t size=sizeof(kv_rec_t)+KV_ALIGN4(h->len);
+		if(h->key>=KV_KEYS || h->len>KV_VALUE_MAX || wr+size>end)
+		{
+			wr=end;						// cabecalho incompleto: nada depois dele e confiavel
+			return;
+		}
+		const uint32_t *data=(const uint32_t *)(wr+sizeof(kv_rec_t));
+		if(kv_crc(h->key|((uint32_t)h->len<<16),data,KV_ALIGN4(h->len)/4U)==h->crc)
+		{
+			kv_cache[h->key].len=h->len?h->len:KV_ABSENT;
+			memcpy(kv_cache[h->key].v.b,data,h->len);
+		}
+		wr+=size;
+	}
+}
+
+/* Copia o valor atual de cada chave e o registro novo para o outro banco e passa a usa-lo */
+static int kv_swap(uint16_t key, const void *data, uint16_t len)
+{
+	uint8_t old=active;
+	uint32_t old_wr=wr;
+	kv_bank_t h={generation+1U,KV_MAGIC};
+	int err;
+
+	active^=1U;
+	wr=KV_BANK(active)+sizeof(kv_bank_t);
+	err=kv_erase(active);				// normalmente ja em branco: foi apagado quando deixou de valer
+	for(uint16_t k=0;k<KV_KEYS && !err;k++)
+	{
+		if(k!=key && kv_cache[k].len!=KV_ABSENT)
+		{
+			err=kv_append(k,kv_cache[k].v.b,kv_cache[k].len);
+		}
+	}
+	if(!err && len)
+	{
+		err=kv_append(key,data,len);
+	}
+	if(!err)
+	{
+		err=flash_program(KV_BANK(active),&h,sizeof(h));
+	}
+	if(err)
+	{
+		active=old;
+		wr=old_wr;
+		return -1;
+	}
+
+	generation=h.generation;
+	kv_erase(old);						// se falhar, a geracao maior ainda decide e a proxima troca apaga de novo
+	return 0;
+}
+
+/* Escolhe o banco valido mais novo (ou formata o primeiro) e carrega kv_cache. Devolve 0 ou -1. */
+int kv_init(void)
+{
+	int found=-1;
+	int err=0;
+
+	RCC->AHBENR|=RCC_AHBENR_CRCEN;
+
+	for(uint8_t b=0;b<2;b++)
+	{
+		const kv_bank_t *h=(const kv_bank_t *)KV_BANK(b);
+		if(h->magic==KV_MAGIC && (found<0 || (int32_t)(h->generation-generation)>0))
+		{
+			found=b;
+			generation=h->generation;
+		}
+	}
+
+	if(found<0)
+	{
+		// Primeiro uso, ou nenhum cabecalho completo: comeca do zero no banco 0
+		kv_bank_t h={1U,KV_MAGIC};
+		flash_unlock();
+		err=(kv_erase(0)<0 || flash_program(KV_BANK(0),&h,sizeof(h))<0)?-1:0;
+		flash_lock();
+		found=0;
+		generation=1U;
+	}
+	active=(uint8_t)found;
+	kv_scan();
+	if(err)
+	{
+		wr=KV_BANK(active)+KV_BANK_SIZE;	// a primeira escrita tenta o outro banco
+	}
+	return err;
+}
+
+/* Copia o valor de key para data (ate size bytes). Devolve o tamanho do valor ou -1 se a chave nao existe. */
+int kv_get(uint16_t key, void *data, uint16_t size)
+{
+	if(key>=KV_KEYS || kv_cache[key].len==KV_ABSENT)
+	{
+		return -1;
+	}
+	memcpy(data,kv_cache[key].v.b,(kv_cache[key].len<size)?kv_cache[key].len:size);
+	return kv_cache[key].len;
+}
+
+/*
+ * Grava len bytes (1 a KV_VALUE_MAX; 0 apaga a chave). Cada escrita leva ~50 us por meia-palavra e, quando o banco
+ * enche, ~100 ms para a troca. Devolve 0 ou -1.
+ * */
+int kv_set(uint16_t key, const void *data, uint16_t len)
+{
+	kv_entry_t *e;
+	int err;
+
+	if(key>=KV_KEYS || len>KV_VALUE_MAX)
+	{
+		return -1;
+	}
+	e=&kv_cache[key];
+	if(len==0?(e->len==KV_ABSENT):(e->len==len && memcmp(e->v.b,data,len)==0))
+	{
+		return 0;
+	}
+
+	flash_unlock();
+	err=kv_append(key,data,len);
+	if(err)
+	{
+		err=kv_swap(key,data,len);
+	}
+	flash_lock();
+
+	if(!err)
+	{
+		e->len=len?len:KV_ABSENT;
+		memcpy(e->v.b,data,len);
+	}
+	return err;
+}
+
+int kv_delete(uint16_t key)
+{
+	return kv_set(key,"",0);
+}
+
+/* Bytes livres no banco ativo */
+uint32_t kv_free(void)
+{
+	return KV_BANK(active)+KV_BANK_SIZE-wr;
+}
+
+uint32_t kv_generation(void)
+{
+	return generation;
+}
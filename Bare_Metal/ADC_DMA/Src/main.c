@@ -25,6 +25,32 @@
 uint16_t adcValues[3];  // Variável global para armazenar os valores do ADC via DMA (dois canais)
 
 #include "stm32f1xx.h"
+#include "i2c_slave.h"
+#include "pins.h"
+#include "system.h"
+#include "ramfunc.h"
+#include "kv.h"
+
+/*
+ * Estado que sobrevive a um reset a quente (watchdog, NVIC_SystemReset): fica em .noinit, que o startup nao
+ * zera. Depois de um reset assim os duties voltam antes do primeiro ciclo do laco, sem esperar o hospedeiro.
+ */
+#define WARM_MAGIC	0x5741524DUL	// "WARM"
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t resets;
+	uint16_t pwm[3];
+	uint16_t check;
+} warm_state_t;
+
+static warm_state_t warm NOINIT;
+
+static uint16_t warm_check(const warm_state_t *w)
+{
+	return (uint16_t)(w->magic ^ (w->magic >> 16) ^ w->resets ^ w->pwm[0] ^ w->pwm[1] ^ w->pwm[2]);
+}
 void ADC_Init (void)
 {
 	/************** STEPS TO FOLLOW *****************
@@ -43,7 +69,8 @@ void ADC_Init (void)
 		RCC->APB2ENR |= (1<<2); // GPIOA
 
 		//2. Set the prescalar in the Clock configuration register (RCC_CFGR)
-		RCC->CFGR |= (2<<14);  // Prescaler 6, ADC Clock = 72/6 = 12 MHz
+		// Prescaler 6, ADC Clock = 72/6 = 12 MHz (ja programado pelo SystemInit junto com o PLL)
+		RCC->CFGR |= RCC_CFGR_ADCPRE_DIV6;
 
 		//3. Set the Scan Mode and Resolution in the Control Register 1 (CR1)
 		ADC1->CR1 = (1<<8);    // SCAN mode enabled
@@ -70,10 +97,7 @@ void ADC_Init (void)
 		//6. Set the Regular channel sequence length in ADC_SQR1
 			ADC1->SQR1 |= (3<<20);   // SQR1_L =3 for 16 conversions
 
-		//7. Set the Respective GPIO PINs in the Analog Mode
-			GPIOA->CRL &= ~(0xf<<4);  // analog mode for PA 1
-			GPIOA->CRL &= ~(0xf<<16); // analog mode for PA 4
-			GPIOA->CRL &= ~(0xf<<8); // analog mode for PA 2
+		//7. Os pinos PA1, PA4 e PA2 ja estao no modo analogico (GPIO_CONFIG no inicio de main)
 
 		//8. Enable DMA for ADC
 		ADC1->CR2 |= (1<<8);
@@ -122,21 +146,16 @@ void ADC_Start(void)
 }
 void PWM_Init(void)
 {
-    // Habilitar o clock para o GPIOB e TIM3
-    RCC->APB2ENR |= (1 << 3); // Habilitar clock do GPIOB
+    // Habilitar o clock do TIM3 (os pinos PA7, PB0 e PB1 sao configurados no inicio de main)
     RCC->APB1ENR |= (1 << 1); // Habilitar clock do TIM3
 
-    // Configurar os pinos GPIOB 8, 9, 10 como saída alternativa para PWM (modo push-pull)
-    GPIOB->CRH &= ~(0xFFF << 0);  // Limpar os bits de configuração dos pinos 8, 9 e 10
-    GPIOB->CRH |= (0xAAA << 0);   // Configurar os pinos 8, 9, 10 como saída alternativa, 50MHz
-
     // Configurar o temporizador TIM3 para modo PWM
-    TIM3->PSC = 72 - 1; // Prescaler para obter clock de 1 MHz
+    TIM3->PSC = SYSTEM_TIM_APB1_HZ / 1000000U - 1; // Prescaler para obter clock de 1 MHz
     TIM3->ARR = 4095;   // Contagem máxima para correspondência com valor do ADC (12 bits)
 
-    // Modo PWM no canal 3 (PB0), canal 4 (PB1) e canal 2 (PB10)
-    TIM3->CCMR1 |= (6 << 12) | (6 << 4); // PWM mode 1 para CH2 e CH3
-    TIM3->CCMR2 |= (6 << 4);             // PWM mode 1 para CH4
+    // Modo PWM no canal 2 (PA7), canal 3 (PB0) e canal 4 (PB1)
+    TIM3->CCMR1 |= (6 << 12);            // PWM mode 1 para CH2
+    TIM3->CCMR2 |= (6 << 12) | (6 << 4); // PWM mode 1 para CH4 e CH3
 
     TIM3->CCER |= (1 << 4) | (1 << 8) | (1 << 12); // Habilitar os canais de saída CH2, CH3 e CH4
 
@@ -152,12 +171,34 @@ void PWM_SetDutyCycle(uint16_t red, uint16_t green, uint16_t blue)
 
 int main(void)
 {
-	//habilite para usa o GPIOB clock
-	RCC->APB2ENR |= (1 << 3);
+    // O Reset_Handler ja trocou o clock para o PLL (system.c); boot_time_us() mede o tempo ate aqui e
+    // vai para o registrador I2C_SLAVE_REG_BOOT_US do mapa
+    SystemCoreClockUpdate();
+
+    // O startup ja copiou o .ramfunc e a tabela de vetores para a SRAM; aqui so se mede quanto cada funcao ocupa
+    ramfunc_init();
+
+    // Configuracao gravada na flash (kv.h); daqui em diante as leituras vem da copia na RAM
+    kv_init();
+
+    // Reset a quente so conta se nao foi power-on/brown-out e o estado em .noinit estiver integro
+    uint8_t warm_reset = !(RCC->CSR & RCC_CSR_PORRSTF) && warm.magic == WARM_MAGIC && warm.check == warm_check(&warm);
+    RCC->CSR |= RCC_CSR_RMVF;
+    if (warm_reset)
+    {
+        warm.resets++;
+    }
+    else
+    {
+        warm.magic = WARM_MAGIC;
+        warm.resets = 0;
+        warm.pwm[0] = warm.pwm[1] = warm.pwm[2] = 0;
+    }
+    warm.check = warm_check(&warm);
 
-    // Configura os pinos GPIOB 8, 9 e 10 como saída
-    GPIOB->CRH &= 0xFFFFF000; // Limpa os bits de configuração dos pinos 8, 9 e 10
-    GPIOB->CRH |= 0x00000222; // Configura os pinos 8, 9 e 10 como saída push-pull, máxima velocidade de 2 MHz
+    // Todos os pinos de main (pins.h) em uma escrita de CRL/CRH por porta; o GPIO_CONFIG tambem liga o clock da porta
+    GPIO_CONFIG(A, PIN_ADC_CH1, PIN_ADC_CH4, PIN_ADC_CH2, PIN_PWM_R);
+    GPIO_CONFIG(B, PIN_LED1, PIN_LED2, PIN_LED3, PIN_PWM_G, PIN_PWM_B);
 
 	ADC_Init ();
 	ADC_Enable ();
@@ -225,41 +266,42 @@ int main(void)
 
 	ADC_Start ();
 
-    // Define um limiar para os valores do ADC (ajuste conforme necessário)
-    uint16_t limiar1 = 2000;  // Limiar para o canal 1 (PA1)
-    uint16_t limiar2 = 2500;  // Limiar para o canal 4 (PA4)
-    uint16_t limiar3 = 1500;  // Limiar para o canal 2 (PA2)
+    // Limiares dos valores do ADC: os gravados na flash pelo hospedeiro (registradores I2C_SLAVE_REG_LIMIAR) ou os padroes
+    uint16_t limiar[3] = {
+    		kv_get_u16(KV_KEY_LIMIAR1, 2000),  // Limiar para o canal 1 (PA1)
+    		kv_get_u16(KV_KEY_LIMIAR2, 2500),  // Limiar para o canal 4 (PA4)
+    		kv_get_u16(KV_KEY_LIMIAR3, 1500)   // Limiar para o canal 2 (PA2)
+    };
 
+    // Duties atuais do TIM3, expostos no mapa do escravo I2C e alterados pelo hospedeiro
+    uint16_t pwm[3] = {warm.pwm[0], warm.pwm[1], warm.pwm[2]};
+
+    PWM_Init();
+    PWM_SetDutyCycle(pwm[0], pwm[1], pwm[2]);
+    i2c_slave_init();
 
     while (1)
     {
-    	// Verificar o valor do primeiro ADC (PA1) e acionar apenas o LED correspondente (PB8)
-    		if (adcValues[0] > limiar1)
+    		if (i2c_slave_take_pwm(pwm))
     		{
-    			GPIOB->BSRR |= (1 << 8); // Acender LED no PB8
+    			PWM_SetDutyCycle(pwm[0], pwm[1], pwm[2]);
+    			warm.pwm[0] = pwm[0];
+    			warm.pwm[1] = pwm[1];
+    			warm.pwm[2] = pwm[2];
+    			warm.check = warm_check(&warm);
     		}
-    		else
+    		if (i2c_slave_take_limiar(limiar))
     		{
-    			GPIOB->BRR |= (1 << 8); // Apagar LED no PB8
+    			// So as chaves que mudaram sao gravadas; o I2C continua sendo atendido durante a gravacao
+    			kv_set_u16(KV_KEY_LIMIAR1, limiar[0]);
+    			kv_set_u16(KV_KEY_LIMIAR2, limiar[1]);
+    			kv_set_u16(KV_KEY_LIMIAR3, limiar[2]);
     		}
+    		i2c_slave_publish(adcValues, pwm, limiar);
 
-    		// Verificar o valor do segundo ADC (PA4) e acionar apenas o LED correspondente (PB9)
-    		if (adcValues[1] > limiar2)
-    		{
-    			GPIOB->BSRR |= (1 << 9); // Acender LED no PB9
-    		}
-    		else
-    		{
-    			GPIOB->BRR |= (1 << 9); // Apagar LED no PB9
-    		}
-    		// Verificar o valor do segundo ADC (PA4) e acionar apenas o LED correspondente (PB9)
-    		if (adcValues[2] > limiar3)
-    		{
-    			GPIOB->BSRR |= (1 << 10); // Acender LED no PB9
-    		}
-    		else
-    		{
-    			GPIOB->BRR |= (1 << 10); // Apagar LED no PB9
-    		}
+    	// Acende cada LED enquanto o canal correspondente estiver acima do limiar (uma escrita em BSRR por LED)
+    		GPIO_WRITE(PIN_LED1, adcValues[0] > limiar[0]);  // PA1 -> PB8
+    		GPIO_WRITE(PIN_LED2, adcValues[1] > limiar[1]);  // PA4 -> PB9
+    		GPIO_WRITE(PIN_LED3, adcValues[2] > limiar[2]);  // PA2 -> PB10
     }
 }
@@ -0,0 +1,65 @@
+#include "ramfunc.h"
+
+/* Simbolos do linker: codigo relocado, tabela de vetores na SRAM e tabela de registros */
+extern uint8_t _sramfunc[];
+extern uint8_t _eramfunc[];
+extern uint8_t _sram_vector[];
+extern uint8_t _eram_vector[];
+extern ramfunc_stat_t _sramfunc_stats[];
+extern ramfunc_stat_t _eramfunc_stats[];
+
+/*
+ * Calcula a SRAM ocupada por cada funcao registrada e zera as medidas. O tamanho vem dos enderecos: vai do inicio
+ * da funcao ate a proxima funcao registrada, ou ate _eramfunc para a ultima, e inclui o alinhamento e o literal pool.
+ * */
+void ramfunc_init(void)
+{
+	uint32_t n=(uint32_t)(_eramfunc_stats-_sramfunc_stats);
+	uint32_t lo=(uint32_t)_sramfunc;
+	uint32_t hi=(uint32_t)_eramfunc;
+
+	for(uint32_t i=0;i<n;i++)
+	{
+		ramfunc_stat_t *s=&_sramfunc_stats[i];
+		uint32_t a=(uint32_t)s->fn&~1UL;				// sem o bit Thumb
+		uint32_t end=hi;
+
+		s->bytes=0;
+		s->calls=0;
+		s->cycles=0;
+		s->min=0xFFFFFFFFUL;
+		s->max=0;
+		if(a<lo || a>=hi)
+		{
+			continue;
+		}
+		for(uint32_t j=0;j<n;j++)
+		{
+			uint32_t b=(uint32_t)_sramfunc_stats[j].fn&~1UL;
+			if(b>a && b<end)
+			{
+				end=b;
+			}
+		}
+		s->bytes=end-a;
+	}
+}
+
+/* Devolve a tabela de registros e a quantidade de entradas */
+uint32_t ramfunc_report(const ramfunc_stat_t **table)
+{
+	*table=_sramfunc_stats;
+	return (uint32_t)(_eramfunc_stats-_sramfunc_stats);
+}
+
+/* SRAM total ocupada pelo codigo relocado */
+uint32_t ramfunc_code_bytes(void)
+{
+	return (uint32_t)(_eramfunc-_sramfunc);
+}
+
+/* SRAM ocupada pela copia da tabela de vetores */
+uint32_t ramfunc_vector_bytes(void)
+{
+	return (uint32_t)(_eram_vector-_sram_vector);
+}
@@ -0,0 +1,71 @@
+#include "system.h"
+
+/*
+ * Inicializacao do clock, chamada pelo Reset_Handler antes de copiar o .data e zerar o .bss, para que esses lacos
+ * ja rodem a 72 MHz. Por isso SystemInit() nao pode usar variaveis globais: o valor seria sobrescrito logo depois.
+ * */
+
+uint32_t SystemCoreClock;
+uint32_t boot_clock_cycles;
+uint32_t boot_cycles;
+
+void SystemInit(void)
+{
+	uint32_t timeout=SYSTEM_HSE_TIMEOUT;
+	uint32_t pll;
+
+	RCC->CR|=RCC_CR_HSEON;
+	while(!(RCC->CR&RCC_CR_HSERDY) && --timeout);
+
+	if(RCC->CR&RCC_CR_HSERDY)
+	{
+		pll=RCC_CFGR_PLLSRC|RCC_CFGR_PLLMULL9;			// 8 MHz x 9 = 72 MHz
+	}
+	else
+	{
+		RCC->CR&=~RCC_CR_HSEON;
+		pll=RCC_CFGR_PLLMULL16;							// HSI/2 x 16 = 64 MHz
+	}
+
+	// 2 wait states acima de 48 MHz, com o buffer de prefetch ligado
+	FLASH->ACR=FLASH_ACR_PRFTBE|FLASH_ACR_LATENCY_2;
+
+	RCC->CFGR=pll|RCC_CFGR_HPRE_DIV1|RCC_CFGR_PPRE1_DIV2|RCC_CFGR_PPRE2_DIV1|RCC_CFGR_ADCPRE_DIV6;
+	RCC->CR|=RCC_CR_PLLON;
+	while(!(RCC->CR&RCC_CR_PLLRDY));
+
+	RCC->CFGR|=RCC_CFGR_SW_PLL;
+	while((RCC->CFGR&RCC_CFGR_SWS)!=RCC_CFGR_SWS_PLL);
+}
+
+/* Recalcula SystemCoreClock a partir do RCC */
+void SystemCoreClockUpdate(void)
+{
+	uint32_t cfgr=RCC->CFGR;
+
+	switch(cfgr&RCC_CFGR_SWS)
+	{
+		case RCC_CFGR_SWS_HSE:
+			SystemCoreClock=SYSTEM_HSE_HZ;
+			break;
+		case RCC_CFGR_SWS_PLL:
+		{
+			uint32_t mul=((cfgr&RCC_CFGR_PLLMULL)>>RCC_CFGR_PLLMULL_Pos)+2U;
+			if(mul>16U)
+			{
+				mul=16U;
+			}
+			SystemCoreClock=(cfgr&RCC_CFGR_PLLSRC)?SYSTEM_HSE_HZ*mul:(SYSTEM_HSI_HZ/2U)*mul;
+			break;
+		}
+		default:
+			SystemCoreClock=SYSTEM_HSI_HZ;
+			break;
+	}
+}
+
+/* Tempo do reset ate main em us: a parte antes da troca de clock conta a 8 MHz (HSI) */
+uint32_t boot_time_us(void)
+{
+	return boot_clock_cycles/(SYSTEM_HSI_HZ/1000000U)+(boot_cycles-boot_clock_cycles)/(SystemCoreClock/1000000U);
+}
@@ -57,42 +57,82 @@ defined in linker script */
 Reset_Handler:
   ldr   r0, =_estack
   mov   sp, r0          /* set stack pointer */
-/* Call the clock system initialization function.*/
-  bl  SystemInit
 
-/* Copy the data segment initializers from flash to SRAM */
+/* Start the DWT cycle counter so the time from reset to main can be measured */
+  ldr r0, =0xE000EDFC   /* CoreDebug->DEMCR */
+  ldr r1, [r0]
+  orr r1, r1, #0x01000000   /* TRCENA */
+  str r1, [r0]
+  ldr r0, =0xE0001000   /* DWT->CTRL */
+  movs r1, #0
+  str r1, [r0, #4]      /* DWT->CYCCNT = 0 */
+  ldr r1, [r0]
+  orr r1, r1, #1        /* CYCCNTENA */
+  str r1, [r0]
+
+/* Call the clock system initialization function first, so the loops below already run at full speed.
+   r10 keeps the cycle count at the clock switch (callee-saved, untouched by the loops and the libc init). */
+  bl  SystemInit
+  ldr r0, =0xE0001004
+  ldr r10, [r0]
+
+/* Copy the vector table, the SRAM code (.ramfunc) and the data segment initializers from flash to SRAM.
+   The linker script keeps all of these word aligned. */
+  ldr r0, =_sram_vector
+  ldr r1, =_eram_vector
+  ldr r2, =g_pfnVectors
+  bl CopyWords
+  ldr r0, =_sramfunc
+  ldr r1, =_eramfunc
+  ldr r2, =_siramfunc
+  bl CopyWords
   ldr r0, =_sdata
   ldr r1, =_edata
   ldr r2, =_sidata
+  bl CopyWords
+
+/* Take exceptions from the SRAM copy of the vector table */
+  ldr r0, =0xE000ED08   /* SCB->VTOR */
+  ldr r1, =_sram_vector
+  str r1, [r0]
+  dsb
+
+/* Zero fill the bss segment, also 16 bytes per STM. .noinit comes after _ebss and is left untouched. */
+  ldr r0, =_sbss
+  ldr r1, =_ebss
+  subs r1, r1, r0
   movs r3, #0
-  b LoopCopyDataInit
-
-CopyDataInit:
-  ldr r4, [r2, r3]
-  str r4, [r0, r3]
-  adds r3, r3, #4
-
-LoopCopyDataInit:
-  adds r4, r0, r3
-  cmp r4, r1
-  bcc CopyDataInit
-
-/* Zero fill the bss segment. */
-  ldr r2, =_sbss
-  ldr r4, =_ebss
-  movs r3, #0
+  movs r4, #0
+  movs r5, #0
+  movs r6, #0
   b LoopFillZerobss
 
 FillZerobss:
-  str  r3, [r2]
-  adds r2, r2, #4
+  stmia r0!, {r3-r6}
 
 LoopFillZerobss:
-  cmp r2, r4
-  bcc FillZerobss
+  subs r1, r1, #16
+  bhs FillZerobss
+  adds r1, r1, #16
+  b LoopFillZeroTail
+
+FillZeroTail:
+  str r3, [r0], #4
+
+LoopFillZeroTail:
+  subs r1, r1, #4
+  bhs FillZeroTail
 
 /* Call static constructors */
   bl __libc_init_array
+
+/* Record the boot time: cycles at the clock switch and at the call to main */
+  ldr r0, =boot_clock_cycles
+  str r10, [r0]
+  ldr r1, =0xE0001004
+  ldr r1, [r1]
+  ldr r0, =boot_cycles
+  str r1, [r0]
 /* Call the application's entry point.*/
   bl main
 
@@ -101,6 +141,33 @@ LoopForever:
 
   .size Reset_Handler, .-Reset_Handler
 
+/* Copies [r0, r1) from r2, 16 bytes per LDM/STM pair, then the 0-3 remaining words. Clobbers r0-r6. */
+  .type CopyWords, %function
+CopyWords:
+  subs r1, r1, r0
+  b LoopCopyWords
+
+CopyWords16:
+  ldmia r2!, {r3-r6}
+  stmia r0!, {r3-r6}
+
+LoopCopyWords:
+  subs r1, r1, #16
+  bhs CopyWords16
+  adds r1, r1, #16
+  b LoopCopyTail
+
+CopyTail:
+  ldr r3, [r2], #4
+  str r3, [r0], #4
+
+LoopCopyTail:
+  subs r1, r1, #4
+  bhs CopyTail
+  bx lr
+
+  .size CopyWords, .-CopyWords
+
 /**
  * @brief  This is the code that gets called when the processor receives an
  *         unexpected interrupt.  This simply enters an infinite loop, preserving
@@ -0,0 +1,48 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+# Toolchain: GNU Tools for STM32 (12.3.rel1)
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+C_SRCS += \
+../Src/crc.c \
+../Src/flash.c \
+../Src/main.c \
+../Src/serial.c \
+../Src/slots.c \
+../Src/syscalls.c \
+../Src/sysmem.c \
+../Src/system.c 
+
+OBJS += \
+./Src/crc.o \
+./Src/flash.o \
+./Src/main.o \
+./Src/serial.o \
+./Src/slots.o \
+./Src/syscalls.o \
+./Src/sysmem.o \
+./Src/system.o 
+
+C_DEPS += \
+./Src/crc.d \
+./Src/flash.d \
+./Src/main.d \
+./Src/serial.d \
+./Src/slots.d \
+./Src/syscalls.d \
+./Src/sysmem.d \
+./Src/system.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+Src/%.o Src/%.su Src/%.cyclo: ../Src/%.c Src/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DDEBUG -DSTM32 -DSTM32F1 -DSTM32F103C8Tx '-DSTM32F103xB= STM32F103xB' -c -I"/home/user/STM32CubeIDE/workspace_1.16.0/Bootloader/Inc" -I"/home/user/STM32CubeIDE/workspace_1.16.0/Bootloader/F1_Header/Include" -I"/home/user/STM32CubeIDE/workspace_1.16.0/Bootloader/F1_Header/Device/ST/STM32F1xx/Include" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
+
+clean: clean-Src
+
+clean-Src:
+	-$(RM) ./Src/crc.cyclo ./Src/crc.d ./Src/crc.o ./Src/crc.su ./Src/flash.cyclo ./Src/flash.d ./Src/flash.o ./Src/flash.su ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/serial.cyclo ./Src/serial.d ./Src/serial.o ./Src/serial.su ./Src/slots.cyclo ./Src/slots.d ./Src/slots.o ./Src/slots.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su ./Src/system.cyclo ./Src/system.d ./Src/system.o ./Src/system.su
+
+.PHONY: clean-Src
+
@@ -0,0 +1,29 @@
+#ifndef BOOT_API_H_
+#define BOOT_API_H_
+
+#include "stdint.h"
+
+/*
+ * Funcoes do bootloader para a aplicacao, numa tabela em endereco fixo logo depois da tabela de vetores do
+ * bootloader. A aplicacao inclui so este arquivo e chama, por exemplo, BOOT_API->confirm().
+ *
+ * Uma imagem nova e iniciada "em teste", com o IWDG ligado (~3,3 s, system.h): ate o proximo reset a aplicacao
+ * precisa alimentar o IWDG (IWDG->KR = 0xAAAA) e, depois de conferir que funciona, chamar confirm(). Sem a
+ * confirmacao, depois de BOOT_TRIALS inicios o bootloader volta para a imagem anterior.
+ * */
+
+#define BOOT_API_ADDR			0x08000140UL
+#define BOOT_API_MAGIC			0x424F4F54UL		// "BOOT"
+#define BOOT_API_VERSION		1U
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t version;
+	int (*confirm)(void);					// marca a imagem em teste como boa; 0 ou -1
+	void (*request_update)(void);			// reinicia no modo de carga do bootloader (nao retorna)
+} boot_api_t;
+
+#define BOOT_API				((const boot_api_t *)BOOT_API_ADDR)
+
+#endif /* BOOT_API_H_ */
@@ -0,0 +1,137 @@
+#ifndef BOOT_PROTO_H_
+#define BOOT_PROTO_H_
+
+#include "stdint.h"
+
+/*
+ * Mapa da flash e protocolo serial do bootloader. Este arquivo e compartilhado com o programa de carga do PC
+ * (Tools/bl_upload.c), entao so pode depender de stdint.h.
+ *
+ * STM32F103C8, 64 KB em paginas de 1 KB:
+ *
+ *   0x08000000  bootloader                10 KB
+ *   0x08002800  slot A: imagem            26 KB
+ *   0x08009000          metadados          1 KB
+ *   0x08009400  slot B: imagem            26 KB
+ *   0x0800FC00          metadados          1 KB
+ *
+ * A imagem roda de onde foi gravada, entao cada slot precisa de uma compilacao propria da aplicacao, ligada no
+ * endereco do slot (FLASH ORIGIN = BOOT_SLOT_BASE(n), LENGTH = 26K). O bootloader diz qual slot vai receber a
+ * proxima imagem e o programa de carga escolhe o arquivo correspondente.
+ * */
+
+#define BOOT_FLASH_BASE			0x08000000UL
+#define BOOT_FLASH_SIZE			0x10000UL
+#define BOOT_PAGE_SIZE			1024U
+#define BOOT_LOADER_SIZE		0x2800UL
+#define BOOT_SLOTS				2U
+#define BOOT_SLOT_STRIDE		0x6C00UL					// imagem + pagina de metadados
+#define BOOT_SLOT_SIZE			0x6800UL					// maior imagem aceita
+#define BOOT_SLOT_BASE(n)		(BOOT_FLASH_BASE+BOOT_LOADER_SIZE+(uint32_t)(n)*BOOT_SLOT_STRIDE)
+#define BOOT_META_ADDR(n)		(BOOT_SLOT_BASE(n)+BOOT_SLOT_SIZE)
+
+/*
+ * Protocolo (USART1, PA9 = TX, PA10 = RX, 8N1, BOOT_BAUD):
+ *
+ * 1. O PC envia BOOT_SYNC ate receber BOOT_ACK.
+ * 2. Depois disso tudo o que o PC envia e um boot_frame_t de tamanho fixo, e cada quadro e respondido com um
+ *    boot_reply_t. Quadro com CRC errado ou incompleto: resposta BOOT_NAK com BOOT_ST_CRC/BOOT_ST_TIMEOUT, e o PC
+ *    reenvia o mesmo quadro. Qualquer outro BOOT_NAK encerra a carga.
+ * 3. INFO -> slot de destino; BEGIN (boot_begin_t nos dados) -> apaga os metadados do slot; DATA em ordem de
+ *    offset, todos com BOOT_BLOCK bytes menos o ultimo; END -> confere o CRC da imagem gravada e grava os
+ *    metadados; BOOT -> inicia a imagem nova.
+ *    CRC (boot_crc_t nos dados) calcula o CRC de um trecho da flash e devolve tambem os ciclos gastos: serve para
+ *    conferir a imagem gravada com o CRC-32 padrao e para comparar os metodos (bl_upload -t).
+ *
+ * Cada DATA e confirmado assim que chega, antes de ser gravado: o proximo quadro e recebido pelo DMA enquanto a CPU
+ * grava o anterior. Um erro de gravacao aparece na resposta do quadro seguinte (ou do END).
+ *
+ * CRC dos quadros e da imagem: o da unidade de CRC do STM32 (polinomio 0x04C11DB7, valor inicial 0xFFFFFFFF, sem
+ * reflexao e sem XOR final), palavra por palavra em little-endian; a imagem e completada com 0xFF ate multiplo de 4.
+ * */
+
+#ifndef BOOT_BAUD
+#define BOOT_BAUD				1000000UL			// ate 2 Mbaud (PCLK2 = 72 MHz); o PC usa o mesmo valor (-s)
+#endif
+#define BOOT_SYNC				0x7FU
+#define BOOT_ACK				0x79U
+#define BOOT_NAK				0x1FU
+#define BOOT_BLOCK				1024U
+
+#define BOOT_CMD_INFO			0x01U
+#define BOOT_CMD_BEGIN			0x02U
+#define BOOT_CMD_DATA			0x03U
+#define BOOT_CMD_END			0x04U
+#define BOOT_CMD_BOOT			0x05U
+#define BOOT_CMD_CRC			0x06U
+
+#define BOOT_ST_OK				0x00U
+#define BOOT_ST_CRC				0x01U		// quadro danificado: reenviar
+#define BOOT_ST_TIMEOUT			0x02U		// quadro incompleto: reenviar
+#define BOOT_ST_CMD				0x03U		// comando desconhecido ou fora de ordem
+#define BOOT_ST_RANGE			0x04U		// offset ou tamanho fora do slot
+#define BOOT_ST_FLASH			0x05U		// falha ao apagar, gravar ou conferir a flash
+#define BOOT_ST_IMAGE			0x06U		// CRC da imagem gravada diferente do anunciado no BEGIN
+#define BOOT_ST_NOIMAGE			0x07U		// BOOT sem nenhum slot valido
+
+typedef struct
+{
+	uint8_t cmd;
+	uint8_t reserved;
+	uint16_t length;				// bytes validos em data
+	uint32_t offset;				// DATA: posicao dentro do slot
+	uint8_t data[BOOT_BLOCK];
+	uint32_t crc;					// das palavras anteriores
+} boot_frame_t;
+
+#define BOOT_FRAME_WORDS		((sizeof(boot_frame_t)-4U)/4U)
+
+/* Dados do BEGIN */
+typedef struct
+{
+	uint32_t slot;
+	uint32_t size;
+	uint32_t crc;
+	uint32_t version;
+} boot_begin_t;
+
+/* Dados do CRC */
+typedef struct
+{
+	uint32_t method;				// BOOT_CRC_*
+	uint32_t addr;					// trecho da flash; alinhado em 4 nos metodos por palavra
+	uint32_t length;
+} boot_crc_t;
+
+#define BOOT_CRC_WORDS_CPU		0U		// CRC do protocolo, unidade alimentada pela CPU
+#define BOOT_CRC_WORDS_DMA		1U		// CRC do protocolo, unidade alimentada pelo DMA
+#define BOOT_CRC_32				2U		// CRC-32 padrao (zlib) pela unidade, com reflexao por software
+#define BOOT_CRC_32_SOFT		3U		// CRC-32 padrao por tabela
+#define BOOT_CRC_32C			4U		// CRC-32C (Castagnoli) por tabela
+#define BOOT_CRC_METHODS		5U
+
+typedef struct
+{
+	uint8_t ack;					// BOOT_ACK ou BOOT_NAK
+	uint8_t status;					// BOOT_ST_*
+	uint8_t cmd;					// comando respondido
+	uint8_t slot;					// INFO: slot de destino; BOOT: slot iniciado
+	uint32_t offset;				// INFO: endereco do slot; DATA: proximo offset esperado; CRC: o CRC
+	uint32_t value;					// INFO: tamanho maximo da imagem; CRC: ciclos da CPU gastos no calculo
+	uint32_t crc;					// das tres palavras anteriores
+} boot_reply_t;
+
+#define BOOT_REPLY_WORDS		3U
+
+/* Um passo do CRC do STM32 (para o PC; no microcontrolador a conta e feita pela unidade de CRC) */
+static inline uint32_t boot_crc_word(uint32_t crc, uint32_t word)
+{
+	crc^=word;
+	for(uint8_t i=0;i<32;i++)
+	{
+		crc=(crc&0x80000000UL)?(crc<<1)^0x04C11DB7UL:(crc<<1);
+	}
+	return crc;
+}
+
+#endif /* BOOT_PROTO_H_ */
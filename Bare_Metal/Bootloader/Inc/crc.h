@@ -0,0 +1,29 @@
+#ifndef CRC_H_
+#define CRC_H_
+
+#include "stdint.h"
+
+/*
+ * Unidade de CRC do STM32 e CRCs padrao.
+ *
+ * A unidade do F103 so faz uma coisa: CRC-32 0x04C11DB7, valor inicial 0xFFFFFFFF, uma palavra de 32 bits por
+ * escrita, bit mais significativo primeiro, sem reflexao e sem XOR final (e o CRC do protocolo, boot_proto.h).
+ * crc_words() alimenta a unidade pela CPU ou, a partir de CRC_DMA_MIN_WORDS, pelo DMA1 canal 1 em modo memoria ->
+ * periferico (o DMA nao gasta instrucoes por palavra e le a flash com os wait states sem parar a CPU no laco).
+ *
+ * crc32() devolve o CRC-32 padrao (zlib, Ethernet): a mesma unidade, com cada palavra refletida por __RBIT antes de
+ * entrar e o resultado refletido e invertido no fim. Como a reflexao e feita pela CPU, esse caminho nao usa o DMA.
+ * O CRC-32C (Castagnoli, 0x1EDC6F41) tem outro polinomio e e feito em software, por tabela.
+ * */
+
+#define CRC_DMA_MIN_WORDS		32U
+
+void crc_init(void);
+uint32_t crc_words(const uint32_t *data, uint32_t words);
+uint32_t crc_words_cpu(const uint32_t *data, uint32_t words);
+uint32_t crc_words_dma(const uint32_t *data, uint32_t words);
+uint32_t crc32(const void *data, uint32_t length);
+uint32_t crc32_soft(const void *data, uint32_t length);
+uint32_t crc32c(const void *data, uint32_t length);
+
+#endif /* CRC_H_ */
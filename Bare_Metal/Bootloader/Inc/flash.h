@@ -0,0 +1,20 @@
+#ifndef FLASH_H_
+#define FLASH_H_
+
+#include "stdint.h"
+
+/*
+ * Gravacao da flash interna. As rotinas nao usam variaveis globais porque tambem sao chamadas pela aplicacao pela
+ * tabela boot_api_t (a RAM e da aplicacao nesse momento). Retornam 0 ou -1.
+ *
+ * O F103 so grava meias-palavras apagadas (0xFFFF), com uma excecao: 0x0000 pode ser gravado por cima de qualquer
+ * valor. flash_clear16() usa isso para os contadores de tentativa e as marcas de confirmacao dos metadados.
+ * */
+
+void flash_unlock(void);
+void flash_lock(void);
+int flash_erase_page(uint32_t addr);
+int flash_program(uint32_t addr, const void *data, uint32_t length);
+int flash_clear16(uint32_t addr);
+
+#endif /* FLASH_H_ */
@@ -0,0 +1,20 @@
+#ifndef SERIAL_H_
+#define SERIAL_H_
+
+#include "stdint.h"
+
+/*
+ * USART1 (PA9 = TX, PA10 = RX). A recepcao dos quadros e feita pelo DMA1 canal 5 direto no buffer do quadro; a
+ * transmissao das respostas (16 bytes) e por espera no TXE.
+ * */
+
+void serial_init(uint32_t baud);
+int serial_getc(void);
+void serial_write(const void *data, uint32_t length);
+void serial_drain(void);
+void serial_quiet(uint32_t ms);
+void serial_rx_start(void *buffer, uint32_t length);
+void serial_rx_stop(void);
+uint32_t serial_rx_missing(void);
+
+#endif /* SERIAL_H_ */
@@ -0,0 +1,44 @@
+#ifndef SLOTS_H_
+#define SLOTS_H_
+
+#include "stdint.h"
+#include "boot_proto.h"
+
+/*
+ * Metadados de um slot, na ultima pagina do slot. A pagina e apagada no BEGIN (o slot deixa de ser valido) e o
+ * registro e gravado no END, com magic por ultimo: uma carga interrompida nunca deixa um slot meio valido.
+ *
+ * Os campos de estado comecam em 0xFFFF e so mudam para 0x0000, o que o F103 permite sem apagar a pagina:
+ * - attempts[i]: o bootloader gastou a i-esima tentativa de iniciar a imagem ainda nao confirmada;
+ * - confirmed: a aplicacao chamou boot_api_t.confirm();
+ * - rejected: as tentativas acabaram sem confirmacao, a imagem foi descartada (rollback para o outro slot).
+ * */
+
+#define BOOT_META_MAGIC			0x4D455441UL		// "META"
+#define BOOT_TRIALS				3U
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t seq;					// geracao: a maior e a imagem mais nova
+	uint32_t size;
+	uint32_t crc;
+	uint32_t version;
+	uint16_t attempts[BOOT_TRIALS];
+	uint16_t confirmed;
+	uint16_t rejected;
+	uint16_t reserved;
+} boot_meta_t;
+
+#define SLOT_META(n)			((const boot_meta_t *)BOOT_META_ADDR(n))
+
+int slot_valid(uint8_t n);
+int slot_pick(void);
+uint8_t slot_target(void);
+uint32_t slot_next_seq(void);
+int slot_begin(uint8_t n);
+int slot_commit(uint8_t n, const boot_begin_t *image);
+int slot_start(uint8_t *trial);
+int slot_confirm(void);
+
+#endif /* SLOTS_H_ */
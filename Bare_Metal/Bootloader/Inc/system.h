@@ -0,0 +1,33 @@
+#ifndef SYSTEM_H_
+#define SYSTEM_H_
+
+#include "stdint.h"
+#include "stm32f1xx.h"
+
+/*
+ * Clock do bootloader: HSE de 8 MHz x 9 = 72 MHz (2 wait states), APB1 = 36 MHz, APB2 = 72 MHz. Sem cristal usa
+ * HSI/2 x 16 = 64 MHz. O USART1 fica no APB2, entao 1 Mbaud (72 ou 64 divisores) e 2 Mbaud saem exatos.
+ *
+ * A aplicacao nunca herda esse clock: o bootloader pede o salto gravando BKP->DR1 e reinicia o chip, e o
+ * SystemInit() seguinte salta para o slot antes de mexer no RCC, com o chip como saiu do reset.
+ * */
+#define SYSTEM_HSE_HZ			8000000UL
+#define SYSTEM_HSI_HZ			8000000UL
+#define SYSTEM_HSE_TIMEOUT		0x5000U
+
+/* Pedidos gravados em BKP->DR1 (sobrevive ao reset enquanto houver VDD ou VBAT) */
+#define BOOT_BKP_MASK			0xFFF0U
+#define BOOT_BKP_JUMP			0xB0A0U		// | slot, | BOOT_BKP_TRIAL
+#define BOOT_BKP_TRIAL			0x0008U		// imagem em teste: liga o IWDG antes do salto
+#define BOOT_BKP_UPDATE			0xB0D0U		// a aplicacao pediu uma atualizacao: fica no modo de carga
+
+/* IWDG de uma imagem em teste: LSI (~40 kHz) / 32, 4095 contagens = ~3,3 s para a aplicacao confirmar ou alimentar */
+#define BOOT_TRIAL_WDG_PR		3U
+#define BOOT_TRIAL_WDG_RLR		4095U
+
+void SystemCoreClockUpdate(void);
+uint32_t system_ms(void);
+void system_bkp_write(uint16_t value);
+void system_reset_to(uint16_t request) __attribute__((noreturn));
+
+#endif /* SYSTEM_H_ */
@@ -0,0 +1,128 @@
+#include "crc.h"
+#include "stm32f1xx.h"
+
+#define CRC32_POLY_REFLECTED	0xEDB88320UL		// 0x04C11DB7 refletido
+#define CRC32C_POLY_REFLECTED	0x82F63B78UL		// 0x1EDC6F41 refletido
+#define CRC_DMA_MAX_WORDS		0xFFFFU				// CNDTR tem 16 bits
+
+/* Tabelas dos CRCs por software, montadas em crc_init() na RAM para nao gastar 2 KB da flash do bootloader */
+static uint32_t crc32_table[256];
+static uint32_t crc32c_table[256];
+
+static void crc_table(uint32_t *table, uint32_t poly)
+{
+	for(uint32_t i=0;i<256U;i++)
+	{
+		uint32_t c=i;
+		for(uint8_t b=0;b<8;b++)
+		{
+			c=(c&1U)?(c>>1)^poly:(c>>1);
+		}
+		table[i]=c;
+	}
+}
+
+void crc_init(void)
+{
+	RCC->AHBENR|=RCC_AHBENR_CRCEN|RCC_AHBENR_DMA1EN;
+	crc_table(crc32_table,CRC32_POLY_REFLECTED);
+	crc_table(crc32c_table,CRC32C_POLY_REFLECTED);
+}
+
+/* Unidade alimentada pela CPU, uma escrita por palavra (a unidade calcula cada palavra em 1 ciclo de AHB) */
+uint32_t crc_words_cpu(const uint32_t *data, uint32_t words)
+{
+	CRC->CR=CRC_CR_RESET;
+	while(words--)
+	{
+		CRC->DR=*data++;
+	}
+	return CRC->DR;
+}
+
+/* Unidade alimentada pelo DMA1 canal 1 (memoria -> CRC->DR, 32 bits); data precisa estar alinhado em 4 */
+uint32_t crc_words_dma(const uint32_t *data, uint32_t words)
+{
+	CRC->CR=CRC_CR_RESET;
+	while(words)
+	{
+		uint32_t n=(words>CRC_DMA_MAX_WORDS)?CRC_DMA_MAX_WORDS:words;
+
+		DMA1_Channel1->CCR=0;
+		DMA1->IFCR=DMA_IFCR_CGIF1;
+		DMA1_Channel1->CPAR=(uint32_t)&CRC->DR;
+		DMA1_Channel1->CMAR=(uint32_t)data;
+		DMA1_Channel1->CNDTR=n;
+		DMA1_Channel1->CCR=DMA_CCR_MEM2MEM|DMA_CCR_MSIZE_1|DMA_CCR_PSIZE_1|DMA_CCR_MINC|DMA_CCR_DIR|DMA_CCR_EN;
+		while(!(DMA1->ISR&(DMA_ISR_TCIF1|DMA_ISR_TEIF1)));
+		DMA1_Channel1->CCR=0;
+
+		data+=n;
+		words-=n;
+	}
+	return CRC->DR;
+}
+
+/* CRC do protocolo; o DMA so compensa a partir de algumas dezenas de palavras */
+uint32_t crc_words(const uint32_t *data, uint32_t words)
+{
+	if(words>=CRC_DMA_MIN_WORDS && !((uint32_t)data&3U))
+	{
+		return crc_words_dma(data,words);
+	}
+	return crc_words_cpu(data,words);
+}
+
+/* Termina um CRC refletido byte a byte (ate 3 bytes, sem tabela) */
+static uint32_t crc32_tail(uint32_t c, const uint8_t *p, uint32_t length)
+{
+	while(length--)
+	{
+		c^=*p++;
+		for(uint8_t b=0;b<8;b++)
+		{
+			c=(c&1U)?(c>>1)^CRC32_POLY_REFLECTED:(c>>1);
+		}
+	}
+	return c;
+}
+
+/*
+ * CRC-32 padrao pela unidade: a unidade processa o bit 31 primeiro e o CRC-32 processa cada byte pelo bit 0, entao
+ * cada palavra (little-endian) entra refletida e o estado da unidade, lido de volta, e o estado refletido. Os bytes
+ * que sobram depois da ultima palavra inteira sao feitos em software a partir desse estado.
+ * */
+uint32_t crc32(const void *data, uint32_t length)
+{
+	const uint8_t *p=data;
+
+	CRC->CR=CRC_CR_RESET;
+	for(uint32_t i=0;i<length/4U;i++,p+=4)
+	{
+		CRC->DR=__RBIT(__UNALIGNED_UINT32_READ(p));
+	}
+	return ~crc32_tail(__RBIT(CRC->DR),p,length&3U);
+}
+
+static uint32_t crc_soft(const uint32_t *table, const void *data, uint32_t length)
+{
+	const uint8_t *p=data;
+	uint32_t c=0xFFFFFFFFUL;
+
+	while(length--)
+	{
+		c=table[(c^*p++)&0xFFU]^(c>>8);
+	}
+	return ~c;
+}
+
+/* CRC-32 padrao por tabela, sem a unidade (referencia para comparar resultado e velocidade) */
+uint32_t crc32_soft(const void *data, uint32_t length)
+{
+	return crc_soft(crc32_table,data,length);
+}
+
+uint32_t crc32c(const void *data, uint32_t length)
+{
+	return crc_soft(crc32c_table,data,length);
+}
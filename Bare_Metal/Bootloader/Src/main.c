@@ -0,0 +1,339 @@
+#include "stm32f1xx.h"
+#include "system.h"
+#include "boot_proto.h"
+#include "boot_api.h"
+#include "serial.h"
+#include "flash.h"
+#include "crc.h"
+#include "slots.h"
+#include "string.h"
+
+/*
+ * Bootloader residente: carga de imagens pela USART1 com DMA e inicio de um dos dois slots (A/B) com rollback.
+ *
+ * Depois do reset o bootloader espera BOOT_SYNC por BOOT_SYNC_WINDOW_MS e, se nada chegar, inicia o melhor slot
+ * (slots.c). Fica no modo de carga quando recebe o SYNC, quando a aplicacao pediu (boot_api_t.request_update) ou
+ * quando nao ha imagem valida.
+ *
+ * No modo de carga os quadros chegam por DMA em dois buffers alternados: assim que um DATA chega inteiro e com CRC
+ * certo o DMA e armado no outro buffer e a resposta e enviada, e so entao a CPU apaga a pagina e grava as 512
+ * meias-palavras. O PC ja esta enviando o quadro seguinte enquanto isso, entao a carga anda no ritmo da flash
+ * (~25 ms por KB para gravar + ~20 ms para apagar), nao no da serial: 26 KB em pouco mais de 1 s.
+ * */
+
+#define BOOT_SYNC_WINDOW_MS		200U		// espera pelo SYNC depois do reset
+#define BOOT_FRAME_TIMEOUT_MS	100U		// quadro comecado e nao terminado (1036 bytes = 10 ms a 1 Mbaud)
+#define BOOT_IDLE_MS			30000U		// modo de carga sem nenhum quadro: tenta iniciar uma imagem
+
+/* Cada DATA apaga a pagina em que comeca (boot_handle()) */
+_Static_assert(BOOT_BLOCK==BOOT_PAGE_SIZE,"um DATA deve ocupar exatamente uma pagina da flash");
+
+static void boot_request_update(void)
+{
+	system_reset_to(BOOT_BKP_UPDATE);
+}
+
+/* Tabela para a aplicacao (boot_api.h), posta em BOOT_API_ADDR pelo linker */
+const boot_api_t boot_api __attribute__((section(".boot_api"),used))=
+{
+	BOOT_API_MAGIC,
+	BOOT_API_VERSION,
+	slot_confirm,
+	boot_request_update
+};
+
+static boot_frame_t frames[2];
+
+/* Estado da carga em curso */
+static uint8_t loading;
+static uint8_t target;
+static boot_begin_t image;
+static uint32_t expected;				// proximo offset de DATA
+static uint8_t flash_failed;			// erro ao gravar um DATA ja confirmado
+
+/* Inicia o melhor slot (reinicia o chip, nao retorna) ou volta se nao houver imagem */
+static void boot_best(void)
+{
+	uint8_t trial;
+	int n=slot_start(&trial);
+
+	if(n>=0)
+	{
+		system_reset_to(BOOT_BKP_JUMP|(uint16_t)n|(trial?BOOT_BKP_TRIAL:0U));
+	}
+}
+
+/* Espera BOOT_SYNC por ate ms milissegundos (0 = para sempre) e responde BOOT_ACK */
+static int boot_wait_sync(uint32_t ms)
+{
+	uint32_t t=system_ms();
+
+	while(!ms || system_ms()-t<ms)
+	{
+		if(serial_getc()==BOOT_SYNC)
+		{
+			// O PC repete o SYNC ate ver o ACK: descarta as copias que ainda estao chegando
+			serial_write(&(uint8_t){BOOT_ACK},1);
+			serial_quiet(5);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static void boot_reply(uint8_t cmd, uint8_t status, uint8_t slot, uint32_t offset, uint32_t value)
+{
+	boot_reply_t r;
+
+	r.ack=(status==BOOT_ST_OK)?BOOT_ACK:BOOT_NAK;
+	r.status=status;
+	r.cmd=cmd;
+	r.slot=slot;
+	r.offset=offset;
+	r.value=value;
+	r.crc=crc_words((const uint32_t *)&r,BOOT_REPLY_WORDS);
+	serial_write(&r,sizeof(r));
+}
+
+/* CRC de um trecho da flash pelo metodo pedido (BOOT_CMD_CRC) */
+static uint32_t boot_crc(const boot_crc_t *c)
+{
+	const uint32_t *p=(const uint32_t *)c->addr;
+
+	switch(c->method)
+	{
+		case BOOT_CRC_WORDS_CPU: return crc_words_cpu(p,c->length/4U);
+		case BOOT_CRC_WORDS_DMA: return crc_words_dma(p,c->length/4U);
+		case BOOT_CRC_32: return crc32(p,c->length);
+		case BOOT_CRC_32_SOFT: return crc32_soft(p,c->length);
+		default: return crc32c(p,c->length);
+	}
+}
+
+/* Resultado da espera por um quadro */
+#define RX_FRAME		0
+#define RX_TIMEOUT		1
+#define RX_IDLE			2
+
+static int boot_receive(const boot_frame_t *frame)
+{
+	uint32_t t=system_ms();
+	uint8_t started=0;
+
+	for(;;)
+	{
+		uint32_t missing=serial_rx_missing();
+		if(missing==0)
+		{
+			return RX_FRAME;
+		}
+		if(!started && missing<sizeof(boot_frame_t))
+		{
+			started=1;
+			t=system_ms();
+		}
+		if(started && system_ms()-t>BOOT_FRAME_TIMEOUT_MS)
+		{
+			serial_rx_stop();
+			// So SYNCs: o PC recomecou do zero (nova execucao do programa de carga)
+			const uint8_t *p=(const uint8_t *)frame;
+			uint32_t got=sizeof(boot_frame_t)-missing;
+			uint32_t i=0;
+			while(i<got && p[i]==BOOT_SYNC)
+			{
+				i++;
+			}
+			if(i==got)
+			{
+				serial_write(&(uint8_t){BOOT_ACK},1);
+				serial_quiet(5);
+				return RX_IDLE;
+			}
+			serial_quiet(5);
+			return RX_TIMEOUT;
+		}
+		if(!started && system_ms()-t>BOOT_IDLE_MS)
+		{
+			return RX_IDLE;
+		}
+	}
+}
+
+/* Trata um quadro com CRC certo; o DMA ja foi armado para o proximo */
+static void boot_handle(const boot_frame_t *f)
+{
+	switch(f->cmd)
+	{
+		case BOOT_CMD_INFO:
+			target=slot_target();
+			boot_reply(f->cmd,BOOT_ST_OK,target,BOOT_SLOT_BASE(target),BOOT_SLOT_SIZE);
+			break;
+
+		case BOOT_CMD_BEGIN:
+		{
+			boot_begin_t b;
+			memcpy(&b,f->data,sizeof(b));
+			if(b.slot!=slot_target() || b.size==0 || b.size>BOOT_SLOT_SIZE)
+			{
+				boot_reply(f->cmd,BOOT_ST_RANGE,(uint8_t)b.slot,0,0);
+				break;
+			}
+			image=b;
+			target=(uint8_t)b.slot;
+			expected=0;
+			flash_failed=0;
+			flash_unlock();
+			loading=(slot_begin(target)==0);
+			boot_reply(f->cmd,loading?BOOT_ST_OK:BOOT_ST_FLASH,target,0,0);
+			break;
+		}
+
+		case BOOT_CMD_DATA:
+			if(!loading)
+			{
+				boot_reply(f->cmd,BOOT_ST_CMD,target,expected,0);
+				break;
+			}
+			if(flash_failed)
+			{
+				boot_reply(f->cmd,BOOT_ST_FLASH,target,expected,0);
+				break;
+			}
+			if(f->offset<expected)
+			{
+				// Repeticao de um quadro cuja resposta se perdeu: ja foi gravado
+				boot_reply(f->cmd,BOOT_ST_OK,target,expected,0);
+				break;
+			}
+			/*
+			 * Cada DATA apaga a pagina onde comeca, entao todos tem de comecar em inicio de pagina: so o ultimo da
+			 * imagem pode ser menor que BOOT_BLOCK (= BOOT_PAGE_SIZE). Um quadro curto no meio faria o seguinte
+			 * comecar no meio de uma pagina e apagar o que acabou de ser gravado.
+			 * */
+			if(f->offset!=expected || f->length==0 || f->length>BOOT_BLOCK || expected+f->length>image.size ||
+					(f->length!=BOOT_BLOCK && expected+f->length!=image.size))
+			{
+				boot_reply(f->cmd,BOOT_ST_RANGE,target,expected,0);
+				break;
+			}
+			expected+=f->length;
+			boot_reply(f->cmd,BOOT_ST_OK,target,expected,0);
+
+			// Gravacao depois da resposta: o proximo quadro chega pelo DMA enquanto isso
+			if(flash_erase_page(BOOT_SLOT_BASE(target)+f->offset)<0 ||
+					flash_program(BOOT_SLOT_BASE(target)+f->offset,f->data,f->length)<0)
+			{
+				flash_failed=1;
+			}
+			break;
+
+		case BOOT_CMD_END:
+		{
+			uint8_t st=BOOT_ST_CMD;
+			if(loading && expected==image.size)
+			{
+				st=flash_failed?BOOT_ST_FLASH:(uint8_t)slot_commit(target,&image);
+			}
+			flash_lock();
+			loading=0;
+			boot_reply(f->cmd,st,target,expected,0);
+			break;
+		}
+
+		case BOOT_CMD_BOOT:
+		{
+			int n=slot_pick();
+			if(n<0)
+			{
+				boot_reply(f->cmd,BOOT_ST_NOIMAGE,0,0,0);
+				break;
+			}
+			boot_reply(f->cmd,BOOT_ST_OK,(uint8_t)n,BOOT_SLOT_BASE(n),0);
+			boot_best();
+			break;
+		}
+
+		case BOOT_CMD_CRC:
+		{
+			boot_crc_t c;
+			memcpy(&c,f->data,sizeof(c));
+			if(c.method>=BOOT_CRC_METHODS || c.addr<BOOT_FLASH_BASE || c.length>BOOT_FLASH_SIZE ||
+					c.addr-BOOT_FLASH_BASE>BOOT_FLASH_SIZE-c.length ||
+					(c.method<=BOOT_CRC_WORDS_DMA && ((c.addr|c.length)&3U)))
+			{
+				boot_reply(f->cmd,BOOT_ST_RANGE,target,0,0);
+				break;
+			}
+			uint32_t t=DWT->CYCCNT;
+			uint32_t crc=boot_crc(&c);
+			boot_reply(f->cmd,BOOT_ST_OK,target,crc,DWT->CYCCNT-t);
+			break;
+		}
+
+		default:
+			boot_reply(f->cmd,BOOT_ST_CMD,target,0,0);
+			break;
+	}
+}
+
+/* Modo de carga: um quadro por vez, alternando os dois buffers */
+static void boot_loader(void)
+{
+	uint8_t cur=0;
+
+	serial_rx_start(&frames[cur],sizeof(boot_frame_t));
+	for(;;)
+	{
+		int rx=boot_receive(&frames[cur]);
+		if(rx==RX_TIMEOUT)
+		{
+			boot_reply(0,BOOT_ST_TIMEOUT,target,expected,0);
+			serial_rx_start(&frames[cur],sizeof(boot_frame_t));
+			continue;
+		}
+		if(rx==RX_IDLE)
+		{
+			if(!loading && serial_rx_missing()==sizeof(boot_frame_t))
+			{
+				boot_best();					// so volta se nao houver imagem
+			}
+			serial_rx_start(&frames[cur],sizeof(boot_frame_t));
+			continue;
+		}
+
+		const boot_frame_t *f=&frames[cur];
+		if(crc_words((const uint32_t *)f,BOOT_FRAME_WORDS)!=f->crc)
+		{
+			uint8_t cmd=f->cmd;
+			serial_quiet(2);
+			serial_rx_start(&frames[cur],sizeof(boot_frame_t));
+			boot_reply(cmd,BOOT_ST_CRC,target,expected,0);
+			continue;
+		}
+
+		cur^=1;
+		serial_rx_start(&frames[cur],sizeof(boot_frame_t));
+		boot_handle(f);
+	}
+}
+
+int main(void)
+{
+	SystemCoreClockUpdate();
+	crc_init();
+	CoreDebug->DEMCR|=CoreDebug_DEMCR_TRCENA_Msk;		// contador de ciclos para o BOOT_CMD_CRC
+	DWT->CTRL|=DWT_CTRL_CYCCNTENA_Msk;
+	serial_init(BOOT_BAUD);
+
+	if(BKP->DR1==BOOT_BKP_UPDATE)
+	{
+		system_bkp_write(0);
+		boot_wait_sync(0);
+	}
+	else if(!boot_wait_sync(BOOT_SYNC_WINDOW_MS))
+	{
+		boot_best();
+		boot_wait_sync(0);					// nenhuma imagem valida
+	}
+	boot_loader();
+}
@@ -0,0 +1,86 @@
+#include "serial.h"
+#include "system.h"
+
+void serial_init(uint32_t baud)
+{
+	RCC->APB2ENR|=RCC_APB2ENR_IOPAEN|RCC_APB2ENR_USART1EN;
+	RCC->AHBENR|=RCC_AHBENR_DMA1EN;
+
+	// PA9: saida alternativa push-pull 50 MHz; PA10: entrada com pull-up (linha parada em 1 sem o adaptador)
+	GPIOA->CRH=(GPIOA->CRH&~(GPIO_CRH_MODE9|GPIO_CRH_CNF9|GPIO_CRH_MODE10|GPIO_CRH_CNF10))|
+			GPIO_CRH_MODE9|GPIO_CRH_CNF9_1|GPIO_CRH_CNF10_1;
+	GPIOA->BSRR=GPIO_BSRR_BS10;
+
+	// APB2 = SYSCLK; arredonda para o divisor mais proximo (72 MHz / 1 Mbaud = 72, exato)
+	USART1->BRR=(SystemCoreClock+baud/2U)/baud;
+	USART1->CR3=USART_CR3_DMAR;
+	USART1->CR1=USART_CR1_UE|USART_CR1_TE|USART_CR1_RE;
+
+	// DMA1 canal 5 = USART1_RX: DR -> memoria, 8 bits, incrementa a memoria, prioridade muito alta
+	DMA1_Channel5->CCR=0;
+	DMA1_Channel5->CPAR=(uint32_t)&USART1->DR;
+}
+
+/* Um byte recebido fora do DMA, ou -1 */
+int serial_getc(void)
+{
+	if(USART1->SR&(USART_SR_RXNE|USART_SR_ORE))
+	{
+		return (uint8_t)USART1->DR;				// a leitura de DR tambem apaga o ORE
+	}
+	return -1;
+}
+
+void serial_write(const void *data, uint32_t length)
+{
+	const uint8_t *p=data;
+
+	while(length--)
+	{
+		while(!(USART1->SR&USART_SR_TXE));
+		USART1->DR=*p++;
+	}
+	while(!(USART1->SR&USART_SR_TC));
+}
+
+/* Descarta o que houver no DR */
+void serial_drain(void)
+{
+	while(serial_getc()>=0);
+}
+
+/* Descarta bytes ate a linha ficar ms milissegundos parada */
+void serial_quiet(uint32_t ms)
+{
+	uint32_t t=system_ms();
+
+	while(system_ms()-t<=ms)
+	{
+		if(serial_getc()>=0)
+		{
+			t=system_ms();
+		}
+	}
+}
+
+/* Arma o DMA para receber exatamente length bytes em buffer */
+void serial_rx_start(void *buffer, uint32_t length)
+{
+	DMA1_Channel5->CCR=0;
+	DMA1->IFCR=DMA_IFCR_CGIF5;
+	serial_drain();
+	DMA1_Channel5->CMAR=(uint32_t)buffer;
+	DMA1_Channel5->CNDTR=length;
+	DMA1_Channel5->CCR=DMA_CCR_MINC|DMA_CCR_PL|DMA_CCR_EN;
+}
+
+void serial_rx_stop(void)
+{
+	DMA1_Channel5->CCR=0;
+}
+
+/* Bytes que ainda faltam para completar a recepcao armada */
+uint32_t serial_rx_missing(void)
+{
+	return DMA1_Channel5->CNDTR;
+}
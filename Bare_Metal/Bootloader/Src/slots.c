@@ -0,0 +1,205 @@
+#include "slots.h"
+#include "flash.h"
+#include "crc.h"
+#include "stddef.h"
+
+/*
+ * Escolha do slot a iniciar, com rollback.
+ *
+ * A imagem mais nova (maior seq) valida e iniciada se ja foi confirmada pela aplicacao ou se ainda tem tentativas;
+ * cada inicio sem confirmacao gasta uma tentativa e liga o IWDG (system.c), entao uma imagem que trava, reinicia
+ * ou simplesmente nunca confirma volta ao bootloader. Esgotadas as BOOT_TRIALS tentativas ela e marcada como
+ * rejeitada e o slot anterior volta a ser o escolhido.
+ *
+ * slot_confirm() e chamada pela aplicacao (boot_api_t) e por isso nao usa variaveis globais nem a unidade de CRC.
+ * */
+
+/* Metadados gravados e nao rejeitados (nao confere o CRC da imagem) */
+static int slot_recorded(uint8_t n)
+{
+	const boot_meta_t *m=SLOT_META(n);
+
+	return m->magic==BOOT_META_MAGIC && m->rejected==0xFFFFU && m->size!=0 && m->size<=BOOT_SLOT_SIZE;
+}
+
+static uint8_t slot_tries_left(uint8_t n)
+{
+	const boot_meta_t *m=SLOT_META(n);
+	uint8_t left=0;
+
+	for(uint8_t i=0;i<BOOT_TRIALS;i++)
+	{
+		left+=(m->attempts[i]==0xFFFFU);
+	}
+	return left;
+}
+
+/* Metadados em ordem, CRC da imagem na flash igual ao gravado e vetor de reset apontando para dentro do slot */
+int slot_valid(uint8_t n)
+{
+	const boot_meta_t *m=SLOT_META(n);
+	const uint32_t *image=(const uint32_t *)BOOT_SLOT_BASE(n);
+
+	if(!slot_recorded(n))
+	{
+		return 0;
+	}
+	if((image[0]&0xFFFE0000UL)!=0x20000000UL || image[1]<BOOT_SLOT_BASE(n) || image[1]>=BOOT_SLOT_BASE(n)+m->size)
+	{
+		return 0;
+	}
+	return crc_words(image,(m->size+3U)/4U)==m->crc;
+}
+
+/* Slot que seria iniciado agora, sem gastar tentativas; -1 se nenhum */
+int slot_pick(void)
+{
+	int best=-1;
+
+	for(uint8_t n=0;n<BOOT_SLOTS;n++)
+	{
+		if(!slot_valid(n) || (SLOT_META(n)->confirmed!=0 && slot_tries_left(n)==0))
+		{
+			continue;
+		}
+		if(best<0 || SLOT_META(n)->seq>SLOT_META(best)->seq)
+		{
+			best=n;
+		}
+	}
+	return best;
+}
+
+/*
+ * Slot que recebe a proxima carga: o outro em relacao a imagem que deve ser preservada, que e a confirmada mais
+ * nova ou, se nenhuma foi confirmada, a valida mais nova.
+ * */
+uint8_t slot_target(void)
+{
+	int keep=-1;
+
+	for(uint8_t pass=0;pass<2 && keep<0;pass++)
+	{
+		for(uint8_t n=0;n<BOOT_SLOTS;n++)
+		{
+			if(!slot_valid(n) || (pass==0 && SLOT_META(n)->confirmed!=0))
+			{
+				continue;
+			}
+			if(keep<0 || SLOT_META(n)->seq>SLOT_META(keep)->seq)
+			{
+				keep=n;
+			}
+		}
+	}
+	return keep<0?0:(uint8_t)(keep^1);
+}
+
+uint32_t slot_next_seq(void)
+{
+	uint32_t seq=0;
+
+	for(uint8_t n=0;n<BOOT_SLOTS;n++)
+	{
+		if(SLOT_META(n)->magic==BOOT_META_MAGIC && SLOT_META(n)->seq>seq)
+		{
+			seq=SLOT_META(n)->seq;
+		}
+	}
+	return seq+1U;
+}
+
+/* Invalida o slot antes de gravar uma imagem nova nele. A flash deve estar destravada. */
+int slot_begin(uint8_t n)
+{
+	return flash_erase_page(BOOT_META_ADDR(n));
+}
+
+/* Confere a imagem gravada e grava os metadados (magic por ultimo). Devolve BOOT_ST_*. */
+int slot_commit(uint8_t n, const boot_begin_t *image)
+{
+	boot_meta_t meta;
+	uint32_t addr=BOOT_META_ADDR(n);
+
+	if(crc_words((const uint32_t *)BOOT_SLOT_BASE(n),(image->size+3U)/4U)!=image->crc)
+	{
+		return BOOT_ST_IMAGE;
+	}
+
+	meta.seq=slot_next_seq();
+	meta.size=image->size;
+	meta.crc=image->crc;
+	meta.version=image->version;
+	if(flash_program(addr+offsetof(boot_meta_t,seq),&meta.seq,4U*4U)<0)
+	{
+		return BOOT_ST_FLASH;
+	}
+	meta.magic=BOOT_META_MAGIC;
+	if(flash_program(addr,&meta.magic,4U)<0)
+	{
+		return BOOT_ST_FLASH;
+	}
+	return BOOT_ST_OK;
+}
+
+/*
+ * Escolhe o slot a iniciar e registra a tentativa. Imagens mais novas que ficaram sem tentativas e sem confirmacao
+ * sao marcadas como rejeitadas. *trial = 1 se a imagem escolhida ainda nao foi confirmada. Devolve -1 se nao ha
+ * nenhuma imagem para iniciar.
+ * */
+int slot_start(uint8_t *trial)
+{
+	int n=slot_pick();
+
+	flash_unlock();
+	for(uint8_t k=0;k<BOOT_SLOTS;k++)
+	{
+		const boot_meta_t *m=SLOT_META(k);
+		if(slot_recorded(k) && m->confirmed!=0 && slot_tries_left(k)==0 && (n<0 || m->seq>SLOT_META(n)->seq))
+		{
+			flash_clear16(BOOT_META_ADDR(k)+offsetof(boot_meta_t,rejected));
+		}
+	}
+
+	*trial=0;
+	if(n>=0 && SLOT_META(n)->confirmed!=0)
+	{
+		*trial=1;
+		uint32_t addr=BOOT_META_ADDR(n)+offsetof(boot_meta_t,attempts)+2U*(BOOT_TRIALS-slot_tries_left(n));
+		flash_clear16(addr);
+	}
+	flash_lock();
+	return n;
+}
+
+/*
+ * Chamada pela aplicacao depois de se verificar: confirma a imagem em teste mais nova (ja iniciada ao menos uma vez
+ * e ainda nao confirmada). Devolve 0, ou -1 se nao havia imagem em teste ou a gravacao falhou.
+ * */
+int slot_confirm(void)
+{
+	int best=-1;
+	int err;
+
+	for(uint8_t n=0;n<BOOT_SLOTS;n++)
+	{
+		const boot_meta_t *m=SLOT_META(n);
+		if(!slot_recorded(n) || m->confirmed==0 || m->attempts[0]!=0)
+		{
+			continue;
+		}
+		if(best<0 || m->seq>SLOT_META(best)->seq)
+		{
+			best=n;
+		}
+	}
+	if(best<0)
+	{
+		return -1;
+	}
+
+	flash_unlock();
+	err=flash_clear16(BOOT_META_ADDR(best)+offsetof(boot_meta_t,confirmed));
+	flash_lock();
+	return err;
+}
@@ -0,0 +1,108 @@
+#include "system.h"
+#include "boot_proto.h"
+
+/*
+ * Inicializacao do chip, chamada pelo Reset_Handler antes de copiar o .data e zerar o .bss: nao pode usar variaveis
+ * globais. Se o reset foi pedido para saltar para um slot, o salto acontece aqui, com RCC, NVIC e perifericos ainda
+ * no estado de reset; so os clocks do PWR/BKP, ligados para ler o pedido, sao desligados de novo.
+ * */
+
+uint32_t SystemCoreClock;
+static volatile uint32_t ticks;
+
+static void system_jump(uint32_t base) __attribute__((noreturn));
+
+static void system_jump(uint32_t base)
+{
+	uint32_t sp=*(const uint32_t *)base;
+	uint32_t pc=*(const uint32_t *)(base+4U);
+
+	SCB->VTOR=base;
+	__DSB();
+	__asm volatile("msr msp, %0\n\tbx %1"::"r"(sp),"r"(pc));
+	__builtin_unreachable();
+}
+
+void SystemInit(void)
+{
+	uint32_t timeout=SYSTEM_HSE_TIMEOUT;
+	uint32_t pll;
+
+	RCC->APB1ENR|=RCC_APB1ENR_PWREN|RCC_APB1ENR_BKPEN;
+	uint16_t request=(uint16_t)BKP->DR1;
+	if((request&BOOT_BKP_MASK)==BOOT_BKP_JUMP)
+	{
+		PWR->CR|=PWR_CR_DBP;
+		BKP->DR1=0;
+		PWR->CR&=~PWR_CR_DBP;
+		RCC->APB1ENR&=~(RCC_APB1ENR_PWREN|RCC_APB1ENR_BKPEN);
+		if(request&BOOT_BKP_TRIAL)
+		{
+			IWDG->KR=0xCCCC;
+			IWDG->KR=0x5555;
+			IWDG->PR=BOOT_TRIAL_WDG_PR;
+			IWDG->RLR=BOOT_TRIAL_WDG_RLR;
+			IWDG->KR=0xAAAA;
+		}
+		system_jump(BOOT_SLOT_BASE(request&1U));
+	}
+
+	RCC->CR|=RCC_CR_HSEON;
+	while(!(RCC->CR&RCC_CR_HSERDY) && --timeout);
+
+	if(RCC->CR&RCC_CR_HSERDY)
+	{
+		pll=RCC_CFGR_PLLSRC|RCC_CFGR_PLLMULL9;			// 8 MHz x 9 = 72 MHz
+	}
+	else
+	{
+		RCC->CR&=~RCC_CR_HSEON;
+		pll=RCC_CFGR_PLLMULL16;							// HSI/2 x 16 = 64 MHz
+	}
+
+	// 2 wait states acima de 48 MHz, com o buffer de prefetch ligado
+	FLASH->ACR=FLASH_ACR_PRFTBE|FLASH_ACR_LATENCY_2;
+
+	RCC->CFGR=pll|RCC_CFGR_HPRE_DIV1|RCC_CFGR_PPRE1_DIV2|RCC_CFGR_PPRE2_DIV1;
+	RCC->CR|=RCC_CR_PLLON;
+	while(!(RCC->CR&RCC_CR_PLLRDY));
+
+	RCC->CFGR|=RCC_CFGR_SW_PLL;
+	while((RCC->CFGR&RCC_CFGR_SWS)!=RCC_CFGR_SWS_PLL);
+}
+
+/* Recalcula SystemCoreClock e liga o SysTick de 1 ms usado pelos prazos do protocolo */
+void SystemCoreClockUpdate(void)
+{
+	uint32_t cfgr=RCC->CFGR;
+	uint32_t mul=((cfgr&RCC_CFGR_PLLMULL)>>RCC_CFGR_PLLMULL_Pos)+2U;
+
+	SystemCoreClock=(cfgr&RCC_CFGR_PLLSRC)?SYSTEM_HSE_HZ*mul:(SYSTEM_HSI_HZ/2U)*mul;
+	SysTick_Config(SystemCoreClock/1000U);
+}
+
+void SysTick_Handler(void)
+{
+	ticks++;
+}
+
+uint32_t system_ms(void)
+{
+	return ticks;
+}
+
+/* Grava o registrador de backup usado para os pedidos entre bootloader e aplicacao */
+void system_bkp_write(uint16_t value)
+{
+	RCC->APB1ENR|=RCC_APB1ENR_PWREN|RCC_APB1ENR_BKPEN;
+	PWR->CR|=PWR_CR_DBP;
+	BKP->DR1=value;
+	PWR->CR&=~PWR_CR_DBP;
+}
+
+/* Grava o pedido e reinicia; o SystemInit() seguinte (ou o main do bootloader) o atende */
+void system_reset_to(uint16_t request)
+{
+	system_bkp_write(request);
+	NVIC_SystemReset();
+}
@@ -0,0 +1,137 @@
+#define _GNU_SOURCE
+#include <string.h>
+#include <sys/mman.h>
+#include "stm32f1xx.h"
+#include "boot_proto.h"
+
+/* Controlador da flash simulado (stm32f1xx.h de teste) */
+
+/* Bit que o codigo nunca escreve no SR: se sumiu, o codigo escreveu no SR (os bits em 1 apagam as flags) */
+#define SIM_FLASH_SR_MARK		(1UL<<31)
+
+FLASH_TypeDef sim_flash;
+
+uint32_t sim_flash_erases;
+uint32_t sim_flash_writes;
+uint32_t sim_flash_pgerr;
+uint32_t sim_flash_stray;
+uint32_t sim_flash_faults;
+
+static uint16_t *mem;							// a flash, em BOOT_FLASH_BASE
+static uint16_t shadow[BOOT_FLASH_SIZE/2U];	// o que a flash realmente contem
+static uint32_t sr;
+static uint8_t key_state;
+
+/* Mapeia a flash no endereco do chip, apagada, com o controlador no estado do reset. Devolve -1 se nao conseguiu. */
+int sim_flash_init(void)
+{
+	void *p=mmap((void *)BOOT_FLASH_BASE,BOOT_FLASH_SIZE,PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS|MAP_FIXED_NOREPLACE,-1,0);
+
+	if(p!=(void *)BOOT_FLASH_BASE)
+	{
+		return -1;
+	}
+	mem=p;
+	memset(mem,0xFF,BOOT_FLASH_SIZE);
+	memset(shadow,0xFF,sizeof(shadow));
+	sim_flash_power_cycle();
+	return 0;
+}
+
+/* Reset do chip: a flash mantem o conteudo, o controlador volta travado */
+void sim_flash_power_cycle(void)
+{
+	memcpy(mem,shadow,BOOT_FLASH_SIZE);
+	memset(&sim_flash,0,sizeof(sim_flash));
+	sim_flash.CR=FLASH_CR_LOCK;
+	sr=0;
+	sim_flash.SR=SIM_FLASH_SR_MARK;
+	key_state=0;
+}
+
+/* Aplica o que o codigo fez desde o ultimo acesso ao FLASH */
+void sim_flash_step(void)
+{
+	FLASH_TypeDef *f=&sim_flash;
+
+	if(f->KEYR!=0)
+	{
+		if(f->KEYR==FLASH_KEY1 && key_state==0)
+		{
+			key_state=1;
+		}
+		else if(f->KEYR==FLASH_KEY2 && key_state==1)
+		{
+			key_state=0;
+			f->CR&=~FLASH_CR_LOCK;
+		}
+		else
+		{
+			key_state=0;
+			sim_flash_faults++;
+		}
+		f->KEYR=0;
+	}
+
+	if(!(f->SR&SIM_FLASH_SR_MARK))
+	{
+		sr&=~f->SR;
+	}
+
+	if((f->CR&FLASH_CR_LOCK) && f->CR!=FLASH_CR_LOCK)
+	{
+		// Com a flash travada o CR nao aceita escrita
+		sim_flash_faults++;
+		f->CR=FLASH_CR_LOCK;
+	}
+
+	// Meias-palavras escritas pela CPU
+	if(memcmp(mem,shadow,BOOT_FLASH_SIZE)!=0)
+	{
+		for(uint32_t i=0;i<BOOT_FLASH_SIZE/2U;i++)
+		{
+			if(mem[i]==shadow[i])
+			{
+				continue;
+			}
+			if(!(f->CR&FLASH_CR_PG))
+			{
+				sim_flash_stray++;
+				mem[i]=shadow[i];
+			}
+			else if(shadow[i]==0xFFFFU || mem[i]==0x0000U)
+			{
+				sim_flash_writes++;
+				shadow[i]=mem[i];
+				sr|=FLASH_SR_EOP;
+			}
+			else
+			{
+				sim_flash_pgerr++;
+				mem[i]=shadow[i];
+				sr|=FLASH_SR_PGERR;
+			}
+		}
+	}
+
+	if(f->CR&FLASH_CR_STRT)
+	{
+		uint32_t off=f->AR-BOOT_FLASH_BASE;
+		if((f->CR&FLASH_CR_PER) && off<BOOT_FLASH_SIZE)
+		{
+			off&=~(BOOT_PAGE_SIZE-1U);
+			memset((uint8_t *)mem+off,0xFF,BOOT_PAGE_SIZE);
+			memset((uint8_t *)shadow+off,0xFF,BOOT_PAGE_SIZE);
+			sim_flash_erases++;
+			sr|=FLASH_SR_EOP;
+		}
+		else
+		{
+			sim_flash_faults++;
+		}
+		f->CR&=~FLASH_CR_STRT;
+	}
+
+	f->SR=sr|SIM_FLASH_SR_MARK;
+}
@@ -0,0 +1,57 @@
+#ifndef STM32F1XX_H
+#define STM32F1XX_H
+
+/*
+ * Substituto do cabecalho do dispositivo para os testes no PC. flash.c e slots.c sao compilados sem alteracao: a
+ * flash de 64 KB e uma regiao de RAM mapeada no proprio endereco BOOT_FLASH_BASE (sim_flash_init()), entao os
+ * ponteiros montados com BOOT_SLOT_BASE()/BOOT_META_ADDR() funcionam como no chip.
+ *
+ * O controlador da flash e simulado a cada acesso ao FLASH (sim_flash_step()), com as regras do F103 (RM0008 3.3,
+ * PM0075): chaves em KEYR para destravar, CR travado ignora escritas, apagar pagina com PER+STRT, e com PG cada
+ * meia-palavra so aceita gravacao se estava em 0xFFFF ou se o valor novo e 0x0000 (senao PGERR e o valor antigo
+ * fica). Uma escrita na flash sem PG e descartada e contada. As operacoes terminam na hora (BSY nunca liga).
+ * */
+
+#include "stdint.h"
+
+typedef struct
+{
+	volatile uint32_t ACR,KEYR,OPTKEYR,SR,CR,AR,RESERVED,OBR,WRPR;
+} FLASH_TypeDef;
+
+extern FLASH_TypeDef sim_flash;
+
+/* Contadores do controlador simulado; os testes zeram e conferem */
+extern uint32_t sim_flash_erases;		// paginas apagadas
+extern uint32_t sim_flash_writes;		// meias-palavras gravadas
+extern uint32_t sim_flash_pgerr;		// gravacoes recusadas (meia-palavra nao apagada)
+extern uint32_t sim_flash_stray;		// escritas na flash sem PG, ou com o CR travado
+extern uint32_t sim_flash_faults;		// chave errada ou escrita no CR travado
+
+#define FLASH					(sim_flash_access())
+
+#define FLASH_KEY1				0x45670123UL
+#define FLASH_KEY2				0xCDEF89ABUL
+
+#define FLASH_SR_BSY			(1U<<0)
+#define FLASH_SR_PGERR			(1U<<2)
+#define FLASH_SR_WRPRTERR		(1U<<4)
+#define FLASH_SR_EOP			(1U<<5)
+
+#define FLASH_CR_PG				(1U<<0)
+#define FLASH_CR_PER			(1U<<1)
+#define FLASH_CR_MER			(1U<<2)
+#define FLASH_CR_STRT			(1U<<6)
+#define FLASH_CR_LOCK			(1U<<7)
+
+int sim_flash_init(void);
+void sim_flash_step(void);
+void sim_flash_power_cycle(void);
+
+static inline FLASH_TypeDef *sim_flash_access(void)
+{
+	sim_flash_step();
+	return &sim_flash;
+}
+
+#endif /* STM32F1XX_H */
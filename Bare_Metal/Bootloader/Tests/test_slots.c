@@ -0,0 +1,249 @@
+/*
+ * Teste da gravacao da flash (Src/flash.c) e da escolha de slots com rollback (Src/slots.c) no PC, contra a flash
+ * simulada de stm32f1xx.h/sim_stm32.c (64 KB de RAM no endereco da flash, com as regras de gravacao do F103).
+ *
+ * As cargas seguem a mesma sequencia do modo de carga de main.c: slot_begin(), um DATA de BOOT_BLOCK bytes por
+ * pagina (apaga e grava) e slot_commit(). A unidade de CRC e trocada pelo CRC do protocolo feito em software
+ * (boot_crc_word() de boot_proto.h), que e o mesmo valor.
+ *
+ * Compilar:  gcc -O2 -Wall -Wextra -Wno-int-to-pointer-cast -I. -I../Inc -o test_slots test_slots.c sim_stm32.c ../Src/flash.c ../Src/slots.c
+ * Uso:       ./test_slots   (retorna 0 se todos os testes passaram)
+ * */
+
+#include <stdio.h>
+#include <string.h>
+#include "stm32f1xx.h"
+#include "boot_proto.h"
+#include "flash.h"
+#include "slots.h"
+#include "crc.h"
+
+static int failures;
+
+#define CHECK(cond)		check((cond),#cond,__LINE__)
+
+static void check(int ok, const char *what, int line)
+{
+	if(!ok)
+	{
+		printf("FALHOU linha %d: %s\n",line,what);
+		failures++;
+	}
+}
+
+/* Unidade de CRC do chip, em software */
+uint32_t crc_words(const uint32_t *data, uint32_t words)
+{
+	uint32_t crc=0xFFFFFFFFUL;
+
+	for(uint32_t i=0;i<words;i++)
+	{
+		crc=boot_crc_word(crc,data[i]);
+	}
+	return crc;
+}
+
+static void counters_reset(void)
+{
+	sim_flash_erases=0;
+	sim_flash_writes=0;
+	sim_flash_pgerr=0;
+	sim_flash_stray=0;
+	sim_flash_faults=0;
+}
+
+/* ---------- Imagens e cargas ---------- */
+
+static uint8_t image[BOOT_SLOT_SIZE+4U];
+
+/* Imagem de size bytes ligada no slot n: pilha na SRAM, reset dentro do slot, o resto pseudoaleatorio */
+static uint32_t image_make(uint8_t n, uint32_t size, uint32_t seed)
+{
+	uint32_t x=seed*2654435761UL+1U;
+
+	for(uint32_t i=0;i<sizeof(image);i++)
+	{
+		x=x*1103515245UL+12345U;
+		image[i]=(uint8_t)(x>>16);
+	}
+	uint32_t sp=0x20005000UL;
+	uint32_t reset=BOOT_SLOT_BASE(n)+0x101U;
+	memcpy(&image[0],&sp,4);
+	memcpy(&image[4],&reset,4);
+	memset(&image[size],0xFF,sizeof(image)-size);		// o PC completa com 0xFF ate multiplo de 4
+	return crc_words((const uint32_t *)image,(size+3U)/4U);
+}
+
+/*
+ * Grava a imagem no slot n como o modo de carga: apaga os metadados, um bloco por pagina e, se blocks cobrir a
+ * imagem inteira, confere e grava os metadados. Devolve o BOOT_ST_* do END, ou -1 se parou antes.
+ * */
+static int load(uint8_t n, uint32_t size, uint32_t crc, uint32_t version, uint32_t blocks)
+{
+	boot_begin_t b={n,size,crc,version};
+	int st=-1;
+
+	flash_unlock();
+	CHECK(slot_begin(n)==0);
+	for(uint32_t off=0,k=0;off<size && k<blocks;off+=BOOT_BLOCK,k++)
+	{
+		uint32_t len=size-off<BOOT_BLOCK?size-off:BOOT_BLOCK;
+		CHECK(flash_erase_page(BOOT_SLOT_BASE(n)+off)==0);
+		CHECK(flash_program(BOOT_SLOT_BASE(n)+off,&image[off],len)==0);
+	}
+	if(blocks*BOOT_BLOCK>=size)
+	{
+		st=slot_commit(n,&b);
+	}
+	flash_lock();
+	return st;
+}
+
+/* ---------- Testes ---------- */
+
+static void test_flash(void)
+{
+	uint32_t page=BOOT_SLOT_BASE(1);
+	const volatile uint16_t *p=(const volatile uint16_t *)page;
+	const uint16_t data[4]={0x1234,0xABCD,0x0F0F,0xFFFF};
+	const uint16_t other[1]={0x4321};
+
+	counters_reset();
+	CHECK(FLASH->CR&FLASH_CR_LOCK);
+	CHECK(flash_program(page,data,sizeof(data))==-1);			// travada: a escrita nao chega na flash
+	CHECK(p[0]==0xFFFF && sim_flash_writes==0 && sim_flash_stray==1 && sim_flash_faults==1);
+
+	counters_reset();
+	flash_unlock();
+	CHECK(!(FLASH->CR&FLASH_CR_LOCK));
+	CHECK(flash_program(page,data,sizeof(data))==0);
+	CHECK(p[0]==0x1234 && p[1]==0xABCD && p[2]==0x0F0F && p[3]==0xFFFF);
+	CHECK(sim_flash_writes==3);								// 0xFFFF sobre 0xFFFF nao muda nada
+
+	CHECK(flash_program(page+2U,other,2)==-1);				// meia-palavra ja gravada
+	CHECK(p[1]==0xABCD && sim_flash_pgerr==1);
+	CHECK(flash_program(page+6U,other,2)==0 && p[3]==0x4321);
+	CHECK(flash_clear16(page+2U)==0 && p[1]==0x0000);			// 0x0000 pode ser gravado por cima
+
+	CHECK(flash_program(page+8U,"\x55\x66\x77",3)==0);			// tamanho impar: o ultimo byte vem de data
+	CHECK(p[4]==0x6655 && p[5]==0x0077);
+	CHECK(flash_erase_page(page+700U)==0);					// qualquer endereco dentro da pagina
+	CHECK(p[0]==0xFFFF && p[1]==0xFFFF && p[511]==0xFFFF && sim_flash_erases==1);
+	flash_lock();
+	CHECK(FLASH->CR&FLASH_CR_LOCK);
+	CHECK(sim_flash_faults==0);
+}
+
+static void test_empty(void)
+{
+	uint8_t trial=0xAA;
+
+	CHECK(!slot_valid(0) && !slot_valid(1));
+	CHECK(slot_pick()==-1);
+	CHECK(slot_target()==0);
+	CHECK(slot_next_seq()==1);
+	CHECK(slot_start(&trial)==-1 && trial==0);
+	CHECK(slot_confirm()==-1);
+}
+
+static void test_bad_image(void)
+{
+	uint32_t size=2U*BOOT_BLOCK+6U;
+	uint32_t crc=image_make(0,size,7);
+
+	CHECK(load(0,size,crc^1U,7,~0U)==BOOT_ST_IMAGE);
+	CHECK(SLOT_META(0)->magic==0xFFFFFFFFUL && !slot_valid(0));
+	CHECK(slot_pick()==-1);
+}
+
+/* Primeira imagem: em teste ate a aplicacao confirmar; depois inicia sem gastar tentativas */
+static void test_first_image(void)
+{
+	uint32_t size=5U*BOOT_BLOCK+6U;							// ultimo bloco curto, tamanho nao multiplo de 4
+	uint32_t crc=image_make(0,size,1);
+	uint8_t trial;
+
+	counters_reset();
+	CHECK(slot_target()==0);
+	CHECK(load(0,size,crc,1,~0U)==BOOT_ST_OK);
+	CHECK(sim_flash_erases==1U+6U && sim_flash_pgerr==0 && sim_flash_stray==0);
+	CHECK(memcmp((const void *)BOOT_SLOT_BASE(0),image,size)==0);
+	CHECK(slot_valid(0) && SLOT_META(0)->seq==1 && SLOT_META(0)->size==size && SLOT_META(0)->version==1);
+	CHECK(slot_pick()==0);
+	CHECK(slot_target()==1);									// a imagem valida mais nova e preservada
+	CHECK(slot_confirm()==-1);									// ainda nao foi iniciada
+
+	sim_flash_power_cycle();
+	CHECK(slot_start(&trial)==0 && trial==1);
+	CHECK(SLOT_META(0)->attempts[0]==0 && SLOT_META(0)->attempts[1]==0xFFFF);
+	CHECK(slot_confirm()==0 && SLOT_META(0)->confirmed==0);
+
+	sim_flash_power_cycle();
+	CHECK(slot_start(&trial)==0 && trial==0);
+	CHECK(SLOT_META(0)->attempts[1]==0xFFFF);					// imagem confirmada nao gasta tentativas
+	CHECK(slot_target()==1);
+	CHECK(sim_flash_faults==0 && (FLASH->CR&FLASH_CR_LOCK));
+}
+
+/* Imagem nova que nunca confirma: BOOT_TRIALS inicios e volta para a anterior */
+static void test_rollback(void)
+{
+	uint32_t size=3U*BOOT_BLOCK;
+	uint32_t crc=image_make(1,size,2);
+	uint8_t trial;
+
+	CHECK(load(1,size,crc,2,~0U)==BOOT_ST_OK);
+	CHECK(SLOT_META(1)->seq==2 && slot_pick()==1);
+	CHECK(slot_target()==1);									// a confirmada (slot 0) continua preservada
+
+	for(uint8_t i=0;i<BOOT_TRIALS;i++)
+	{
+		sim_flash_power_cycle();
+		CHECK(slot_start(&trial)==1 && trial==1);
+	}
+	sim_flash_power_cycle();
+	CHECK(slot_start(&trial)==0 && trial==0);
+	CHECK(SLOT_META(1)->rejected==0 && slot_valid(1)==0);
+	CHECK(slot_pick()==0 && slot_target()==1);
+	CHECK(slot_confirm()==-1);
+}
+
+/* Carga interrompida (queda de energia): o slot fica invalido e a imagem confirmada continua sendo a escolhida */
+static void test_interrupted(void)
+{
+	uint32_t size=4U*BOOT_BLOCK+2U;
+	uint32_t crc=image_make(1,size,3);
+	uint8_t trial;
+
+	CHECK(load(1,size,crc,3,2)==-1);
+	sim_flash_power_cycle();
+	CHECK(!slot_valid(1) && SLOT_META(1)->magic==0xFFFFFFFFUL);
+	CHECK(slot_pick()==0 && slot_target()==1);
+
+	// A nova carga completa, iniciada e confirmada passa a ser a preservada
+	CHECK(load(1,size,crc,3,~0U)==BOOT_ST_OK);
+	CHECK(SLOT_META(1)->seq==2 && slot_next_seq()==3);
+	sim_flash_power_cycle();
+	CHECK(slot_start(&trial)==1 && trial==1);
+	CHECK(slot_confirm()==0);
+	CHECK(slot_pick()==1 && slot_target()==0);
+	CHECK(SLOT_META(1)->version==3);
+}
+
+int main(void)
+{
+	if(sim_flash_init()<0)
+	{
+		printf("FALHOU: nao foi possivel mapear a flash simulada em 0x%08lX\n",(unsigned long)BOOT_FLASH_BASE);
+		return 1;
+	}
+	test_flash();
+	test_empty();
+	test_bad_image();
+	test_first_image();
+	test_rollback();
+	test_interrupted();
+
+	printf("%s: %d falha(s)\n",failures?"FALHOU":"OK",failures);
+	return failures?1:0;
+}
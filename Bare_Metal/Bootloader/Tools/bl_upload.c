@@ -0,0 +1,401 @@
+/*
+ * Programa de carga do Bootloader (Inc/boot_proto.h) para Linux.
+ *
+ * Sincroniza com o bootloader (reinicie a placa depois de iniciar o programa, ou chame BOOT_API->request_update()
+ * na aplicacao), pergunta qual slot vai receber a imagem, envia o arquivo compilado para esse slot e, se nao houver
+ * -n, manda iniciar a imagem nova. Com -t, antes de iniciar, confere a imagem gravada por todos os metodos de CRC
+ * do bootloader (Src/crc.c) e mostra os ciclos que cada um gastou.
+ *
+ * Compilar:  gcc -O2 -Wall -o bl_upload bl_upload.c
+ * Uso:       bl_upload [-s baud] [-v versao] [-n] [-t] /dev/ttyUSB0 app_slot_a.bin [app_slot_b.bin]
+ *
+ * Os .bin saem de arm-none-eabi-objcopy -O binary, um para cada endereco de slot (boot_proto.h).
+ * */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <time.h>
+#include <sys/select.h>
+#include "../Inc/boot_proto.h"
+
+#define BL_SYNC_TIMEOUT_S	30			// espera pelo reset da placa
+#define BL_REPLY_TIMEOUT_MS	1000		// apagar + gravar 1 KB leva ~45 ms; END confere ate 26 KB
+#define BL_RETRIES			5
+
+static int serial_open(const char *dev, unsigned long baud)
+{
+	static const struct
+	{
+		unsigned long baud;
+		speed_t speed;
+	} speeds[]=
+	{
+		{115200,B115200},{230400,B230400},{460800,B460800},{500000,B500000},{921600,B921600},
+		{1000000,B1000000},{1500000,B1500000},{2000000,B2000000}
+	};
+	speed_t speed=0;
+
+	for(size_t i=0;i<sizeof(speeds)/sizeof(speeds[0]);i++)
+	{
+		if(speeds[i].baud==baud)
+		{
+			speed=speeds[i].speed;
+		}
+	}
+	if(speed==0)
+	{
+		fprintf(stderr,"velocidade nao suportada: %lu\n",baud);
+		return -1;
+	}
+
+	int fd=open(dev,O_RDWR|O_NOCTTY);
+	if(fd<0)
+	{
+		perror(dev);
+		return -1;
+	}
+
+	struct termios tio;
+	memset(&tio,0,sizeof(tio));
+	tio.c_cflag=CS8|CREAD|CLOCAL;
+	tio.c_cc[VMIN]=1;
+	cfsetispeed(&tio,speed);
+	cfsetospeed(&tio,speed);
+	if(tcsetattr(fd,TCSANOW,&tio)<0)
+	{
+		perror("tcsetattr");
+		close(fd);
+		return -1;
+	}
+	tcflush(fd,TCIOFLUSH);
+	return fd;
+}
+
+static double now_s(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return (double)ts.tv_sec+(double)ts.tv_nsec*1e-9;
+}
+
+/* Le exatamente n bytes; devolve -1 se passar ms milissegundos sem dados */
+static int read_full(int fd, void *buf, size_t n, unsigned ms)
+{
+	uint8_t *p=buf;
+
+	while(n)
+	{
+		fd_set set;
+		struct timeval tv={ms/1000U,(ms%1000U)*1000U};
+		FD_ZERO(&set);
+		FD_SET(fd,&set);
+		if(select(fd+1,&set,NULL,NULL,&tv)<=0)
+		{
+			return -1;
+		}
+		ssize_t r=read(fd,p,n);
+		if(r<=0)
+		{
+			perror("read");
+			return -1;
+		}
+		p+=r;
+		n-=(size_t)r;
+	}
+	return 0;
+}
+
+static uint32_t crc_words(const void *data, size_t words)
+{
+	const uint8_t *p=data;
+	uint32_t crc=0xFFFFFFFFUL;
+
+	for(size_t i=0;i<words;i++,p+=4)
+	{
+		crc=boot_crc_word(crc,(uint32_t)p[0]|((uint32_t)p[1]<<8)|((uint32_t)p[2]<<16)|((uint32_t)p[3]<<24));
+	}
+	return crc;
+}
+
+/* CRC refletido por bit (CRC-32 padrao com 0xEDB88320, CRC-32C com 0x82F63B78) */
+static uint32_t crc_reflected(uint32_t poly, const uint8_t *p, size_t length)
+{
+	uint32_t c=0xFFFFFFFFUL;
+
+	while(length--)
+	{
+		c^=*p++;
+		for(int b=0;b<8;b++)
+		{
+			c=(c&1U)?(c>>1)^poly:(c>>1);
+		}
+	}
+	return ~c;
+}
+
+/* Envia BOOT_SYNC a cada 50 ms ate o BOOT_ACK */
+static int boot_sync(int fd)
+{
+	double t=now_s();
+
+	while(now_s()-t<BL_SYNC_TIMEOUT_S)
+	{
+		uint8_t c=BOOT_SYNC;
+		if(write(fd,&c,1)!=1)
+		{
+			perror("write");
+			return -1;
+		}
+		while(read_full(fd,&c,1,50)==0)
+		{
+			if(c==BOOT_ACK)
+			{
+				// Deixa passar os SYNCs que ainda estavam no caminho
+				usleep(20000);
+				tcflush(fd,TCIOFLUSH);
+				return 0;
+			}
+		}
+	}
+	fprintf(stderr,"o bootloader nao respondeu em %d s\n",BL_SYNC_TIMEOUT_S);
+	return -1;
+}
+
+/* Envia o quadro e espera a resposta, reenviando em CRC errado, quadro incompleto ou resposta perdida */
+static int boot_transfer(int fd, boot_frame_t *f, boot_reply_t *r)
+{
+	f->crc=crc_words(f,BOOT_FRAME_WORDS);
+	for(int tries=0;tries<BL_RETRIES;tries++)
+	{
+		if(write(fd,f,sizeof(*f))!=(ssize_t)sizeof(*f))
+		{
+			perror("write");
+			return -1;
+		}
+		if(read_full(fd,r,sizeof(*r),BL_REPLY_TIMEOUT_MS)<0 || crc_words(r,BOOT_REPLY_WORDS)!=r->crc)
+		{
+			// Espera o bootloader desistir do quadro (BOOT_ST_TIMEOUT) e descarta o que sobrou
+			usleep(200000);
+			tcflush(fd,TCIFLUSH);
+			continue;
+		}
+		if(r->ack==BOOT_ACK)
+		{
+			return 0;
+		}
+		if(r->status!=BOOT_ST_CRC && r->status!=BOOT_ST_TIMEOUT)
+		{
+			fprintf(stderr,"comando %u recusado: status %u\n",f->cmd,r->status);
+			return -1;
+		}
+	}
+	fprintf(stderr,"comando %u: sem resposta valida depois de %d tentativas\n",f->cmd,BL_RETRIES);
+	return -1;
+}
+
+static uint8_t *load(const char *path, uint32_t *size)
+{
+	FILE *in=fopen(path,"rb");
+	if(in==NULL)
+	{
+		perror(path);
+		return NULL;
+	}
+	uint8_t *buf=malloc(BOOT_SLOT_SIZE+4U);
+	size_t n=fread(buf,1,BOOT_SLOT_SIZE+1U,in);
+	fclose(in);
+	if(n==0 || n>BOOT_SLOT_SIZE)
+	{
+		fprintf(stderr,"%s: tamanho invalido (maximo %lu bytes)\n",path,BOOT_SLOT_SIZE);
+		free(buf);
+		return NULL;
+	}
+	// Completa com 0xFF ate multiplo de 4, como a flash apagada
+	while(n%4U)
+	{
+		buf[n++]=0xFF;
+	}
+	*size=(uint32_t)n;
+	return buf;
+}
+
+/* Calcula o CRC da imagem gravada por cada metodo do bootloader e compara com o calculado aqui */
+static int crc_test(int fd, uint32_t base, const uint8_t *img, uint32_t size)
+{
+	static const char *names[BOOT_CRC_METHODS]=
+	{
+		"STM32, CPU","STM32, DMA","CRC-32, unidade","CRC-32, tabela","CRC-32C, tabela"
+	};
+	uint32_t stm32=crc_words(img,size/4U);
+	uint32_t crc32=crc_reflected(0xEDB88320UL,img,size);
+	uint32_t expected[BOOT_CRC_METHODS]={stm32,stm32,crc32,crc32,crc_reflected(0x82F63B78UL,img,size)};
+	boot_frame_t f;
+	boot_reply_t r;
+	int bad=0;
+
+	printf("%-16s %-10s %10s %12s\n","metodo","CRC","ciclos","bytes/ciclo");
+	for(uint32_t m=0;m<BOOT_CRC_METHODS;m++)
+	{
+		boot_crc_t c={m,base,size};
+		memset(&f,0,sizeof(f));
+		f.cmd=BOOT_CMD_CRC;
+		f.length=sizeof(c);
+		memcpy(f.data,&c,sizeof(c));
+		if(boot_transfer(fd,&f,&r)<0)
+		{
+			return -1;
+		}
+		printf("%-16s 0x%08X %10u %12.3f%s\n",names[m],r.offset,r.value,(double)size/(double)r.value,
+				r.offset==expected[m]?"":"  ERRO");
+		bad|=(r.offset!=expected[m]);
+	}
+	if(bad)
+	{
+		fprintf(stderr,"CRC diferente do calculado no PC\n");
+		return -1;
+	}
+	return 0;
+}
+
+static void usage(void)
+{
+	fprintf(stderr,"uso: bl_upload [-s baud] [-v versao] [-n] [-t] dispositivo app_slot_a.bin [app_slot_b.bin]\n");
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned long baud=BOOT_BAUD;
+	uint32_t version=0;
+	int start=1;
+	int test=0;
+	int opt;
+
+	while((opt=getopt(argc,argv,"s:v:nt"))!=-1)
+	{
+		switch(opt)
+		{
+			case 's': baud=strtoul(optarg,NULL,0); break;
+			case 'v': version=(uint32_t)strtoul(optarg,NULL,0); break;
+			case 'n': start=0; break;
+			case 't': test=1; break;
+			default: usage();
+		}
+	}
+	if(argc-optind<2 || argc-optind>3)
+	{
+		usage();
+	}
+
+	int fd=serial_open(argv[optind],baud);
+	if(fd<0)
+	{
+		return 1;
+	}
+	printf("esperando o bootloader (reinicie a placa)...\n");
+	if(boot_sync(fd)<0)
+	{
+		return 1;
+	}
+
+	boot_frame_t f;
+	boot_reply_t r;
+	memset(&f,0,sizeof(f));
+	f.cmd=BOOT_CMD_INFO;
+	if(boot_transfer(fd,&f,&r)<0)
+	{
+		return 1;
+	}
+	uint8_t slot=r.slot;
+	uint32_t base=r.offset;
+	if(slot>=BOOT_SLOTS || base!=BOOT_SLOT_BASE(slot))
+	{
+		fprintf(stderr,"resposta do INFO invalida\n");
+		return 1;
+	}
+	if(optind+1+slot>=argc)
+	{
+		fprintf(stderr,"o bootloader vai gravar o slot %c (0x%08X): falta o arquivo desse slot\n",'A'+slot,base);
+		return 1;
+	}
+	const char *path=argv[optind+1+slot];
+
+	uint32_t size;
+	uint8_t *img=load(path,&size);
+	if(img==NULL)
+	{
+		return 1;
+	}
+	uint32_t sp=img[0]|((uint32_t)img[1]<<8)|((uint32_t)img[2]<<16)|((uint32_t)img[3]<<24);
+	uint32_t reset=img[4]|((uint32_t)img[5]<<8)|((uint32_t)img[6]<<16)|((uint32_t)img[7]<<24);
+	if((sp&0xFFFE0000UL)!=0x20000000UL || reset<base || reset>=base+size)
+	{
+		fprintf(stderr,"%s nao foi ligado para o slot %c (0x%08X): vetor de reset 0x%08X\n",path,'A'+slot,base,reset);
+		return 1;
+	}
+
+	boot_begin_t b={slot,size,crc_words(img,size/4U),version};
+	printf("%s -> slot %c (0x%08X), %u bytes, CRC 0x%08X\n",path,'A'+slot,base,size,b.crc);
+
+	double t0=now_s();
+	memset(&f,0,sizeof(f));
+	f.cmd=BOOT_CMD_BEGIN;
+	f.length=sizeof(b);
+	memcpy(f.data,&b,sizeof(b));
+	if(boot_transfer(fd,&f,&r)<0)
+	{
+		return 1;
+	}
+
+	for(uint32_t off=0;off<size;off+=BOOT_BLOCK)
+	{
+		uint32_t n=size-off<BOOT_BLOCK?size-off:BOOT_BLOCK;
+		memset(&f,0xFF,sizeof(f));
+		f.cmd=BOOT_CMD_DATA;
+		f.reserved=0;
+		f.length=(uint16_t)n;
+		f.offset=off;
+		memcpy(f.data,img+off,n);
+		if(boot_transfer(fd,&f,&r)<0)
+		{
+			fprintf(stderr,"falha no offset %u\n",off);
+			return 1;
+		}
+		printf("\r%u/%u bytes",off+n,size);
+		fflush(stdout);
+	}
+	printf("\n");
+
+	memset(&f,0,sizeof(f));
+	f.cmd=BOOT_CMD_END;
+	if(boot_transfer(fd,&f,&r)<0)
+	{
+		return 1;
+	}
+	double dt=now_s()-t0;
+	printf("gravado e conferido em %.2f s (%.1f KB/s)\n",dt,(double)size/1024.0/dt);
+
+	if(test && crc_test(fd,base,img,size)<0)
+	{
+		return 1;
+	}
+
+	if(start)
+	{
+		memset(&f,0,sizeof(f));
+		f.cmd=BOOT_CMD_BOOT;
+		if(boot_transfer(fd,&f,&r)<0)
+		{
+			return 1;
+		}
+		printf("iniciando o slot %c\n",'A'+r.slot);
+	}
+	free(img);
+	close(fd);
+	return 0;
+}
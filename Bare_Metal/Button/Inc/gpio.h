@@ -0,0 +1,129 @@
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include "stdint.h"
+#include "stm32f1xx.h"
+
+/*
+ * Pinos descritos em tempo de compilacao.
+ *
+ * Um pino e uma tupla (porta, numero, modo), por exemplo:
+ *
+ * 	#define LED_RED		(B, 6, GPIO_OUT_PP_2MHZ)
+ *
+ * e tudo o que depende dele e constante para o compilador. As operacoes sao macros (e nao funcoes inline) para que,
+ * mesmo com -O0, cada uma gere um unico acesso ao registrador:
+ * 	- GPIO_SET/GPIO_CLR/GPIO_WRITE: uma escrita em BSRR ou BRR, atomica em relacao as interrupcoes (nao ha leitura
+ * 	  de ODR como em "ODR |=", que pode desfazer a alteracao de uma ISR em outro pino da mesma porta);
+ * 	- GPIO_TOGGLE: uma leitura de ODR e uma escrita em BSRR;
+ * 	- GPIO_CONFIG: todos os pinos de uma porta em uma escrita de CRL e uma de CRH (mais uma de BSRR para os pull-ups).
+ *
+ * No F103 a funcao alternativa nao e escolhida por pino: o modo GPIO_AF_* entrega o pino ao periferico e o
+ * remapeamento, quando existe, e feito no AFIO_MAPR.
+ *
+ * Pinos repetidos sao rejeitados na compilacao: GPIO_CONFIG() confere os pinos da chamada e GPIO_ASSERT_DISTINCT()
+ * confere a lista completa de pinos do programa, em todas as portas.
+ * */
+
+/* Modos: CNF[1:0] MODE[1:0] do CRL/CRH; o bit 4 pede ODR = 1 (pull-up) */
+#define GPIO_IN_ANALOG		0x00
+#define GPIO_IN_FLOAT		0x04
+#define GPIO_IN_PULLDOWN	0x08
+#define GPIO_IN_PULLUP		0x18
+#define GPIO_OUT_PP_10MHZ	0x01
+#define GPIO_OUT_PP_2MHZ	0x02
+#define GPIO_OUT_PP_50MHZ	0x03
+#define GPIO_OUT_OD_10MHZ	0x05
+#define GPIO_OUT_OD_2MHZ	0x06
+#define GPIO_OUT_OD_50MHZ	0x07
+#define GPIO_AF_PP_10MHZ	0x09
+#define GPIO_AF_PP_2MHZ		0x0A
+#define GPIO_AF_PP_50MHZ	0x0B
+#define GPIO_AF_OD_10MHZ	0x0D
+#define GPIO_AF_OD_2MHZ		0x0E
+#define GPIO_AF_OD_50MHZ	0x0F
+
+#define GPIO_PORTNUM_A		0
+#define GPIO_PORTNUM_B		1
+#define GPIO_PORTNUM_C		2
+#define GPIO_PORTNUM_D		3
+
+/* Partes de um pino. O argumento p e a tupla inteira: "GPIO_MASK_ p" vira "GPIO_MASK_ (B, 6, modo)". */
+#define GPIO_PORT_(port,pin,mode)		(GPIO##port)
+#define GPIO_MASK_(port,pin,mode)		(1U<<(pin))
+#define GPIO_PORTBIT_(port,pin,mode)	(1U<<GPIO_PORTNUM_##port)
+#define GPIO_UID_(port,pin,mode)		(1ULL<<(16*GPIO_PORTNUM_##port+(pin)))
+#define GPIO_CRL_MASK_(port,pin,mode)	((pin)<8?(0xFU<<(4*(pin))):0U)
+#define GPIO_CRH_MASK_(port,pin,mode)	((pin)<8?0U:(0xFU<<(4*((pin)-8))))
+#define GPIO_CRL_BITS_(port,pin,mode)	((pin)<8?((uint32_t)((mode)&0xF)<<(4*(pin))):0U)
+#define GPIO_CRH_BITS_(port,pin,mode)	((pin)<8?0U:((uint32_t)((mode)&0xF)<<(4*((pin)-8))))
+#define GPIO_PULL_SET_(port,pin,mode)	((mode)==GPIO_IN_PULLUP?(1U<<(pin)):0U)
+#define GPIO_PULL_CLR_(port,pin,mode)	((mode)==GPIO_IN_PULLDOWN?(1U<<(pin)):0U)
+
+#define GPIO_PORT(p)		GPIO_PORT_ p
+#define GPIO_MASK(p)		GPIO_MASK_ p
+
+/* Valores para compor uma escrita de BSRR com varios pinos da mesma porta */
+#define GPIO_BSRR_SET(p)	GPIO_MASK(p)
+#define GPIO_BSRR_RESET(p)	(GPIO_MASK(p)<<16)
+
+#define GPIO_SET(p)			(GPIO_PORT(p)->BSRR=GPIO_MASK(p))
+#define GPIO_CLR(p)			(GPIO_PORT(p)->BRR=GPIO_MASK(p))
+#define GPIO_WRITE(p,v)		(GPIO_PORT(p)->BSRR=(v)?GPIO_MASK(p):(GPIO_MASK(p)<<16))
+#define GPIO_READ(p)		((GPIO_PORT(p)->IDR&GPIO_MASK(p))!=0U)
+#define GPIO_TOGGLE(p)		do { uint32_t gpio_odr_=GPIO_PORT(p)->ODR; \
+								GPIO_PORT(p)->BSRR=((gpio_odr_&GPIO_MASK(p))<<16)|(~gpio_odr_&GPIO_MASK(p)); } while(0)
+
+/* Aplica m a cada pino da lista (ate 16) e junta os resultados com o operador op */
+#define GPIO_NARGS_(...)	GPIO_NARGS_N_(__VA_ARGS__,16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0)
+#define GPIO_NARGS_N_(a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16,n,...)	n
+#define GPIO_CAT_(a,b)		GPIO_CAT2_(a,b)
+#define GPIO_CAT2_(a,b)		a##b
+#define GPIO_MAP(op,m,...)	(GPIO_CAT_(GPIO_MAP_,GPIO_NARGS_(__VA_ARGS__))(op,m,__VA_ARGS__))
+#define GPIO_MAP_1(op,m,a)		m a
+#define GPIO_MAP_2(op,m,a,...)	m a op GPIO_MAP_1(op,m,__VA_ARGS__)
+#define GPIO_MAP_3(op,m,a,...)	m a op GPIO_MAP_2(op,m,__VA_ARGS__)
+#define GPIO_MAP_4(op,m,a,...)	m a op GPIO_MAP_3(op,m,__VA_ARGS__)
+#define GPIO_MAP_5(op,m,a,...)	m a op GPIO_MAP_4(op,m,__VA_ARGS__)
+#define GPIO_MAP_6(op,m,a,...)	m a op GPIO_MAP_5(op,m,__VA_ARGS__)
+#define GPIO_MAP_7(op,m,a,...)	m a op GPIO_MAP_6(op,m,__VA_ARGS__)
+#define GPIO_MAP_8(op,m,a,...)	m a op GPIO_MAP_7(op,m,__VA_ARGS__)
+#define GPIO_MAP_9(op,m,a,...)	m a op GPIO_MAP_8(op,m,__VA_ARGS__)
+#define GPIO_MAP_10(op,m,a,...)	m a op GPIO_MAP_9(op,m,__VA_ARGS__)
+#define GPIO_MAP_11(op,m,a,...)	m a op GPIO_MAP_10(op,m,__VA_ARGS__)
+#define GPIO_MAP_12(op,m,a,...)	m a op GPIO_MAP_11(op,m,__VA_ARGS__)
+#define GPIO_MAP_13(op,m,a,...)	m a op GPIO_MAP_12(op,m,__VA_ARGS__)
+#define GPIO_MAP_14(op,m,a,...)	m a op GPIO_MAP_13(op,m,__VA_ARGS__)
+#define GPIO_MAP_15(op,m,a,...)	m a op GPIO_MAP_14(op,m,__VA_ARGS__)
+#define GPIO_MAP_16(op,m,a,...)	m a op GPIO_MAP_15(op,m,__VA_ARGS__)
+
+/* Verdadeiro se nenhum pino da lista aparece duas vezes (a soma dos bits so e igual ao OU sem repeticao) */
+#define GPIO_DISTINCT(...)	(GPIO_MAP(+,GPIO_UID_,__VA_ARGS__)==GPIO_MAP(|,GPIO_UID_,__VA_ARGS__))
+
+#define GPIO_ASSERT_DISTINCT(...) \
+	_Static_assert(GPIO_DISTINCT(__VA_ARGS__),"pino usado mais de uma vez")
+
+/*
+ * Configura os pinos listados da porta port (A, B, C ou D) e liga o clock da porta. Os demais pinos da porta nao
+ * sao alterados. A compilacao falha se algum pino for de outra porta ou aparecer duas vezes.
+ * */
+#define GPIO_CONFIG(port,...) do { \
+	_Static_assert(GPIO_MAP(|,GPIO_PORTBIT_,__VA_ARGS__)==(1U<<GPIO_PORTNUM_##port), \
+			"GPIO_CONFIG(" #port "): pino de outra porta"); \
+	_Static_assert(GPIO_DISTINCT(__VA_ARGS__),"GPIO_CONFIG(" #port "): pino repetido"); \
+	RCC->APB2ENR|=RCC_APB2ENR_IOP##port##EN; \
+	if(GPIO_MAP(|,GPIO_PULL_SET_,__VA_ARGS__)|GPIO_MAP(|,GPIO_PULL_CLR_,__VA_ARGS__)) \
+	{ \
+		GPIO##port->BSRR=GPIO_MAP(|,GPIO_PULL_SET_,__VA_ARGS__)|(GPIO_MAP(|,GPIO_PULL_CLR_,__VA_ARGS__)<<16); \
+	} \
+	if(GPIO_MAP(|,GPIO_CRL_MASK_,__VA_ARGS__)) \
+	{ \
+		GPIO##port->CRL=(GPIO##port->CRL&~GPIO_MAP(|,GPIO_CRL_MASK_,__VA_ARGS__))|GPIO_MAP(|,GPIO_CRL_BITS_,__VA_ARGS__); \
+	} \
+	if(GPIO_MAP(|,GPIO_CRH_MASK_,__VA_ARGS__)) \
+	{ \
+		GPIO##port->CRH=(GPIO##port->CRH&~GPIO_MAP(|,GPIO_CRH_MASK_,__VA_ARGS__))|GPIO_MAP(|,GPIO_CRH_BITS_,__VA_ARGS__); \
+	} \
+} while(0)
+
+#endif /* GPIO_H_ */
@@ -0,0 +1,64 @@
+#ifndef LOGIC_H_
+#define LOGIC_H_
+
+#include "stdint.h"
+#include "stm32f1xx.h"
+#include "gpio.h"
+
+/* Clock do nucleo (HSI de 8 MHz, sem PLL) */
+#define LOGIC_CPU_HZ		8000000UL
+
+/* Memoria de captura: 8192 amostras de 8 bits ou 4096 de 16 bits */
+#define LOGIC_BUF_BYTES		8192U
+
+/* Taxa maxima: o DMA gasta alguns ciclos de AHB por amostra e divide o barramento com a CPU */
+#define LOGIC_MAX_HZ		1000000UL
+
+/* Amostras de folga depois do fim do pos-disparo, para a latencia da ISR que para o TIM3 */
+#define LOGIC_GUARD			16U
+
+/* USART1 (PA9 TX, PA10 RX): 8 MHz / 16 = 500 kbaud, a maior taxa exata do HSI */
+#define LOGIC_USART_TX		(A, 9, GPIO_AF_PP_50MHZ)
+#define LOGIC_USART_RX		(A, 10, GPIO_IN_FLOAT)
+#define LOGIC_BAUD			500000UL
+#define LOGIC_TX_CHUNK		128U
+
+/* Modos de disparo */
+#define LOGIC_TRIG_NOW		0U
+#define LOGIC_TRIG_RISING	1U
+#define LOGIC_TRIG_FALLING	2U
+#define LOGIC_TRIG_PATTERN	3U
+
+/*
+ * Protocolo (little-endian):
+ *
+ * Comando do host, LOGIC_CMD_LEN bytes:
+ * 	'L' 'A' porta('A'/'B') largura(8/16) taxa_hz(u32) mascara(u16) valor(u16) modo(u8) pino(u8) pre(u16)
+ *
+ * Resposta:
+ * 	'L' 'D' porta largura taxa_hz(u32) amostras(u32) disparo(u32)
+ * 	registros RLE: amostra (1 ou 2 bytes) + repeticoes em LEB128 (>= 1), ate somar "amostras"
+ * 	'L' 'E' soma(u32) dos bytes dos registros RLE
+ *
+ * Em 8 bits sao capturados os pinos 0 a 7 da porta; em 16 bits, todos.
+ * */
+#define LOGIC_CMD_LEN		16U
+
+typedef struct
+{
+	GPIO_TypeDef *port;
+	uint8_t width;			// 8 ou 16
+	uint32_t rate_hz;
+	uint16_t mask;			// LOGIC_TRIG_PATTERN: (amostra & mask) == value
+	uint16_t value;
+	uint8_t trigger;
+	uint8_t pin;			// LOGIC_TRIG_RISING/FALLING: pino da porta capturada
+	uint16_t pre;			// amostras guardadas antes do disparo
+} logic_config_t;
+
+void logic_init(void);
+int logic_start(const logic_config_t *config);
+void logic_poll(void);
+uint8_t logic_busy(void);
+
+#endif /* LOGIC_H_ */
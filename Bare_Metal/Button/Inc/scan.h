@@ -0,0 +1,52 @@
+#ifndef SCAN_H_
+#define SCAN_H_
+
+#include "stdint.h"
+#include "stddef.h"
+#include "stm32f1xx.h"
+
+/* Clock do nucleo (HSI de 8 MHz, sem PLL) e taxa de amostragem do IDR */
+#define SCAN_CPU_HZ			8000000UL
+#define SCAN_HZ				1000U
+
+/*
+ * Amostras no anel de DMA. O processamento acontece a cada meio anel (interrupcoes HT e TC), ou seja, a cada
+ * SCAN_RING/2 ms a 1 kHz. Em modo matriz, o numero de linhas precisa dividir SCAN_RING/2.
+ * */
+#define SCAN_RING			32U
+
+/* Amostras iguais seguidas para aceitar um novo nivel: fixo em 8 pelo contador vertical de 3 bits */
+#define SCAN_DEBOUNCE		8U
+
+/* Tempo segurando a tecla para gerar um evento de aperto longo */
+#define SCAN_LONG_MS		1000U
+
+/*
+ * Configuracao do scanner. Sem matriz (rows = 0 ou 1) cada bit dos eventos e o numero do pino de in_port.
+ * Com matriz, in_mask deve ser contiguo (as colunas) e row_bsrr tem um valor de BSRR por linha, escrito em
+ * row_port antes de cada amostra; a tecla da linha r e coluna c fica no bit r*colunas + c (rows*colunas <= 32).
+ * */
+typedef struct
+{
+	GPIO_TypeDef *in_port;
+	uint16_t in_mask;			// pinos lidos
+	uint16_t active_low;		// pinos em que apertado = 0
+	GPIO_TypeDef *row_port;		// NULL = sem matriz
+	const uint32_t *row_bsrr;
+	uint8_t rows;
+} scan_config_t;
+
+/* Eventos acumulados desde a ultima chamada de scan_events(): um bit por tecla */
+typedef struct
+{
+	uint32_t pressed;
+	uint32_t released;
+	uint32_t long_press;
+} scan_events_t;
+
+int scan_init(const scan_config_t *config);
+uint32_t scan_state(void);
+void scan_events(scan_events_t *events);
+uint32_t scan_overruns(void);
+
+#endif /* SCAN_H_ */
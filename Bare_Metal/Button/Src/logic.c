@@ -0,0 +1,460 @@
+#include "logic.h"
+#include "gpio.h"
+#include "string.h"
+
+/*
+ * Analisador logico.
+ *
+ * O TIM3 marca a taxa de amostragem e, a cada estouro, pede ao DMA1 canal 3 uma copia do IDR da porta para um
+ * buffer circular. A CPU nao toca nas amostras durante a captura, entao o limite e o DMA e nao o codigo.
+ *
+ * O disparo marca a posicao do DMA naquele instante. A partir dai o TIM4, com clock vindo do TRGO do TIM3, conta as
+ * amostras do pos-disparo e, no estouro, a ISR para o TIM3; o buffer fica com as amostras de antes do disparo (ate
+ * "pre") seguidas das de depois, sem copia:
+ * 	- borda: EXTI no pino, disparo feito pelo hardware com a latencia de uma ISR;
+ * 	- padrao: a CPU compara cada meio buffer quando o DMA o termina (HT/TC). Funciona enquanto a CPU conseguir
+ * 	  comparar uma amostra mais rapido do que elas chegam, por volta de 500 kHz a 8 MHz;
+ * 	- imediato: o pos-disparo comeca junto com a captura.
+ *
+ * Terminada a captura, logic_poll() comprime o buffer em RLE e envia pelo USART1 com DMA em dois blocos alternados:
+ * um e transmitido enquanto o outro e preenchido.
+ *
+ * O GPIO e lido em palavras de 32 bits (os registradores do GPIO nao aceitam acesso de 8 ou 16 bits); o DMA grava
+ * so o byte ou a meia palavra de baixo.
+ *
+ * Neste projeto o EXTI e usado apenas pelo disparo por borda.
+ * */
+
+#define LOGIC_IDLE		0
+#define LOGIC_ARMED		1		// capturando, esperando o disparo
+#define LOGIC_POST		2		// disparado, TIM4 contando o pos-disparo
+#define LOGIC_DONE		3		// captura parada, esperando o envio
+
+static uint8_t buf[LOGIC_BUF_BYTES] __attribute__((aligned(4)));
+static logic_config_t cfg;
+static volatile uint8_t phase;
+static uint32_t capacity;
+static uint32_t post;
+static uint32_t pattern_from;
+static volatile uint8_t wrapped;
+static volatile uint32_t trig_index;
+static volatile uint32_t end_index;
+
+static uint8_t rx[LOGIC_CMD_LEN];
+static volatile uint8_t rx_len;
+static volatile uint8_t cmd_ready;
+
+static uint8_t tx[2][LOGIC_TX_CHUNK];
+static uint8_t tx_sel;
+static uint32_t tx_len;
+static uint32_t tx_sum;
+
+static const IRQn_Type exti_irq[16]=
+{
+	EXTI0_IRQn,EXTI1_IRQn,EXTI2_IRQn,EXTI3_IRQn,EXTI4_IRQn,
+	EXTI9_5_IRQn,EXTI9_5_IRQn,EXTI9_5_IRQn,EXTI9_5_IRQn,EXTI9_5_IRQn,
+	EXTI15_10_IRQn,EXTI15_10_IRQn,EXTI15_10_IRQn,EXTI15_10_IRQn,EXTI15_10_IRQn,EXTI15_10_IRQn
+};
+
+void logic_init(void)
+{
+	RCC->APB2ENR|=RCC_APB2ENR_USART1EN|RCC_APB2ENR_AFIOEN;
+	RCC->APB1ENR|=RCC_APB1ENR_TIM3EN|RCC_APB1ENR_TIM4EN;
+	RCC->AHBENR|=RCC_AHBENR_DMA1EN;
+	GPIO_CONFIG(A,LOGIC_USART_TX,LOGIC_USART_RX);
+
+	USART1->BRR=LOGIC_CPU_HZ/LOGIC_BAUD;
+	USART1->CR3=USART_CR3_DMAT;
+	USART1->CR1=USART_CR1_UE|USART_CR1_TE|USART_CR1_RE|USART_CR1_RXNEIE;
+	DMA1_Channel4->CPAR=(uint32_t)&USART1->DR;
+	NVIC_EnableIRQ(USART1_IRQn);
+
+	// TRGO do TIM3 = evento de atualizacao, uma borda por amostra
+	TIM3->CR2=TIM_CR2_MMS_1;
+	// TIM4 em clock externo modo 1 (SMS = 111) pelo ITR2, que no TIM4 e o TRGO do TIM3
+	TIM4->SMCR=TIM_SMCR_TS_1|TIM_SMCR_SMS;
+	TIM4->CR1=TIM_CR1_OPM|TIM_CR1_URS;
+	TIM4->DIER=TIM_DIER_UIE;
+	NVIC_EnableIRQ(TIM4_IRQn);
+	NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+
+	phase=LOGIC_IDLE;
+}
+
+static inline uint32_t logic_sample(uint32_t i)
+{
+	return cfg.width==16?((const uint16_t *)buf)[i]:buf[i];
+}
+
+static void logic_stop(void)
+{
+	uint32_t cnd=DMA1_Channel3->CNDTR;
+
+	TIM3->CR1=0;
+	TIM3->DIER=0;						// sem UDE: um UG da proxima captura nao gera pedido de DMA
+	TIM4->CR1&=~TIM_CR1_CEN;
+	DMA1_Channel3->CCR=0;
+	EXTI->IMR=0;
+	if(DMA1->ISR&DMA_ISR_TCIF3)
+	{
+		wrapped=1;
+	}
+	DMA1->IFCR=DMA_IFCR_CGIF3;
+	end_index=(capacity-cnd)%capacity;
+	phase=LOGIC_DONE;
+}
+
+/* Disparo na amostra index, since amostras atras da posicao atual do DMA */
+static void logic_fire(uint32_t index, uint32_t since)
+{
+	trig_index=index;
+	phase=LOGIC_POST;
+	if(since+1>=post)
+	{
+		logic_stop();
+		return;
+	}
+	TIM4->CNT=0;
+	TIM4->ARR=post-since-1;
+	TIM4->CR1|=TIM_CR1_CEN;
+}
+
+/*
+ * Divide o clock do nucleo pelo periodo de amostragem mais proximo de rate_hz. PSC e ARR tem 16 bits cada: o PSC e
+ * o menor que deixa o ARR caber, e o ARR e arredondado com esse PSC. Retorna a taxa real (arredondada para Hz), ou 0
+ * se rate_hz estiver fora da faixa.
+ * */
+static uint32_t logic_timebase(uint32_t rate_hz, uint16_t *psc, uint16_t *arr)
+{
+	if(rate_hz==0 || rate_hz>LOGIC_MAX_HZ)
+	{
+		return 0;
+	}
+	uint32_t ticks=(LOGIC_CPU_HZ+rate_hz/2U)/rate_hz;				// <= LOGIC_CPU_HZ, cabe em 16+16 bits
+	uint32_t prescale=(ticks-1U)/65536U+1U;
+	uint32_t reload=(ticks+prescale/2U)/prescale;
+	uint32_t period=prescale*reload;
+
+	*psc=(uint16_t)(prescale-1U);
+	*arr=(uint16_t)(reload-1U);
+	return (LOGIC_CPU_HZ+period/2U)/period;
+}
+
+/*
+ * Inicia uma captura. A captura anterior, se houver, e descartada. A taxa usada e a mais proxima que o TIM3 consegue
+ * gerar; e ela que vai no cabecalho da resposta.
+ * Retorna 0 em caso de sucesso ou -1 se a configuracao for invalida.
+ * */
+int logic_start(const logic_config_t *config)
+{
+	uint16_t psc,arr;
+	uint32_t rate=logic_timebase(config->rate_hz,&psc,&arr);
+
+	if((config->port!=GPIOA && config->port!=GPIOB) || (config->width!=8 && config->width!=16)
+			|| rate==0 || config->trigger>LOGIC_TRIG_PATTERN
+			|| config->pin>=config->width || config->pre>=LOGIC_BUF_BYTES/(config->width/8U)-LOGIC_GUARD-1)
+	{
+		return -1;
+	}
+
+	NVIC_DisableIRQ(TIM4_IRQn);
+	NVIC_DisableIRQ(DMA1_Channel3_IRQn);
+	TIM3->CR1=0;
+	TIM3->DIER=0;
+	TIM4->CR1&=~TIM_CR1_CEN;
+	DMA1_Channel3->CCR=0;
+	EXTI->IMR=0;
+
+	cfg=*config;
+	cfg.rate_hz=rate;
+	capacity=LOGIC_BUF_BYTES/(cfg.width/8U);
+	post=capacity-cfg.pre-LOGIC_GUARD;
+	pattern_from=0;
+	wrapped=0;
+	trig_index=0;
+	phase=LOGIC_ARMED;
+
+	/*
+	 * O UG carrega o PSC e gera um evento de atualizacao: ele vem antes de o canal do DMA ser ligado e com UDE
+	 * desligado, senao o evento pediria uma transferencia e buf[0] receberia uma amostra fora do ritmo.
+	 * */
+	TIM3->PSC=psc;
+	TIM3->ARR=arr;
+	TIM3->EGR=TIM_EGR_UG;
+	TIM3->SR=0;
+	TIM3->CNT=0;
+
+	DMA1->IFCR=DMA_IFCR_CGIF3;
+	DMA1_Channel3->CPAR=(uint32_t)&cfg.port->IDR;
+	DMA1_Channel3->CMAR=(uint32_t)buf;
+	DMA1_Channel3->CNDTR=capacity;
+	DMA1_Channel3->CCR=DMA_CCR_PL|(cfg.width==16?DMA_CCR_MSIZE_0:0)|DMA_CCR_PSIZE_1|DMA_CCR_MINC|DMA_CCR_CIRC
+			|DMA_CCR_TCIE|(cfg.trigger==LOGIC_TRIG_PATTERN?DMA_CCR_HTIE:0)|DMA_CCR_EN;
+	TIM3->DIER=TIM_DIER_UDE;			// por ultimo: so as atualizacoes do contador pedem amostras
+
+	if(cfg.trigger==LOGIC_TRIG_RISING || cfg.trigger==LOGIC_TRIG_FALLING)
+	{
+		uint32_t bit=1UL<<cfg.pin;
+		uint32_t shift=(cfg.pin&3U)*4U;
+		uint32_t port_index=(cfg.port==GPIOB);
+
+		AFIO->EXTICR[cfg.pin>>2]=(AFIO->EXTICR[cfg.pin>>2]&~(0xFUL<<shift))|(port_index<<shift);
+		EXTI->RTSR=cfg.trigger==LOGIC_TRIG_RISING?bit:0;
+		EXTI->FTSR=cfg.trigger==LOGIC_TRIG_FALLING?bit:0;
+		EXTI->PR=bit;
+		EXTI->IMR=bit;
+		NVIC_EnableIRQ(exti_irq[cfg.pin]);
+	}
+	else if(cfg.trigger==LOGIC_TRIG_NOW)
+	{
+		logic_fire(0,0);
+	}
+
+	NVIC_EnableIRQ(TIM4_IRQn);
+	NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+	TIM3->CR1=TIM_CR1_CEN;
+	return 0;
+}
+
+uint8_t logic_busy(void)
+{
+	return phase!=LOGIC_IDLE;
+}
+
+static void logic_exti(void)
+{
+	uint32_t cnd=DMA1_Channel3->CNDTR;
+
+	EXTI->IMR=0;
+	EXTI->PR=1UL<<cfg.pin;
+	if(phase==LOGIC_ARMED)
+	{
+		logic_fire((capacity-cnd)%capacity,0);
+	}
+}
+
+void DMA1_Channel3_IRQHandler(void)
+{
+	uint32_t isr=DMA1->ISR;
+
+	DMA1->IFCR=DMA_IFCR_CGIF3;
+	if(isr&DMA_ISR_TCIF3)
+	{
+		wrapped=1;
+	}
+	if(phase!=LOGIC_ARMED || cfg.trigger!=LOGIC_TRIG_PATTERN)
+	{
+		return;
+	}
+
+	uint32_t to=(isr&DMA_ISR_TCIF3)?capacity:capacity/2;
+	for(uint32_t i=pattern_from;i<to;i++)
+	{
+		if((logic_sample(i)&cfg.mask)==cfg.value)
+		{
+			uint32_t cur=capacity-DMA1_Channel3->CNDTR;
+			logic_fire(i,(cur+capacity-i)%capacity);
+			return;
+		}
+	}
+	pattern_from=to%capacity;
+}
+
+void TIM4_IRQHandler(void)
+{
+	TIM4->SR=~TIM_SR_UIF;
+	if(phase==LOGIC_POST)
+	{
+		logic_stop();
+	}
+}
+
+void USART1_IRQHandler(void)
+{
+	if(USART1->SR&USART_SR_RXNE)
+	{
+		uint8_t c=(uint8_t)USART1->DR;
+
+		if(cmd_ready)
+		{
+			return;		// comando anterior ainda nao foi tratado
+		}
+		if((rx_len==0 && c!='L') || (rx_len==1 && c!='A'))
+		{
+			rx_len=(c=='L');
+			return;
+		}
+		rx[rx_len++]=c;
+		if(rx_len==LOGIC_CMD_LEN)
+		{
+			rx_len=0;
+			cmd_ready=1;
+		}
+	}
+}
+
+void EXTI0_IRQHandler(void)
+{
+	logic_exti();
+}
+
+void EXTI1_IRQHandler(void)
+{
+	logic_exti();
+}
+
+void EXTI2_IRQHandler(void)
+{
+	logic_exti();
+}
+
+void EXTI3_IRQHandler(void)
+{
+	logic_exti();
+}
+
+void EXTI4_IRQHandler(void)
+{
+	logic_exti();
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+	logic_exti();
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+	logic_exti();
+}
+
+/* Envia o bloco atual pelo DMA1 canal 4 assim que o anterior terminar e passa a preencher o outro */
+static void tx_flush(void)
+{
+	if(tx_len==0)
+	{
+		return;
+	}
+	while(DMA1_Channel4->CNDTR);
+	DMA1_Channel4->CCR=0;
+	DMA1_Channel4->CMAR=(uint32_t)tx[tx_sel];
+	DMA1_Channel4->CNDTR=tx_len;
+	DMA1_Channel4->CCR=DMA_CCR_MINC|DMA_CCR_DIR|DMA_CCR_EN;
+	tx_sel^=1;
+	tx_len=0;
+}
+
+static void tx_put(uint8_t c)
+{
+	tx[tx_sel][tx_len++]=c;
+	tx_sum+=c;
+	if(tx_len==LOGIC_TX_CHUNK)
+	{
+		tx_flush();
+	}
+}
+
+static void tx_put32(uint32_t v)
+{
+	for(uint8_t i=0;i<4;i++)
+	{
+		tx_put((uint8_t)(v>>(8*i)));
+	}
+}
+
+/* Um registro RLE: a amostra e a quantidade de repeticoes em LEB128 (7 bits por byte, bit 7 = continua) */
+static void tx_run(uint32_t sample, uint32_t run)
+{
+	tx_put((uint8_t)sample);
+	if(cfg.width==16)
+	{
+		tx_put((uint8_t)(sample>>8));
+	}
+	while(run>=0x80)
+	{
+		tx_put((uint8_t)(run|0x80));
+		run>>=7;
+	}
+	tx_put((uint8_t)run);
+}
+
+static void logic_send(void)
+{
+	uint32_t count=wrapped?capacity:end_index;
+	uint32_t start=wrapped?end_index:0;
+
+	tx_put('L');
+	tx_put('D');
+	tx_put(cfg.port==GPIOB?'B':'A');
+	tx_put(cfg.width);
+	tx_put32(cfg.rate_hz);
+	tx_put32(count);
+	tx_put32((trig_index+capacity-start)%capacity);
+
+	tx_sum=0;
+	if(count)
+	{
+		uint32_t i=start;
+		uint32_t prev=logic_sample(i);
+		uint32_t run=1;
+		for(uint32_t n=1;n<count;n++)
+		{
+			if(++i==capacity)
+			{
+				i=0;
+			}
+			uint32_t s=logic_sample(i);
+			if(s==prev)
+			{
+				run++;
+				continue;
+			}
+			tx_run(prev,run);
+			prev=s;
+			run=1;
+		}
+		tx_run(prev,run);
+	}
+
+	uint32_t sum=tx_sum;
+	tx_put('L');
+	tx_put('E');
+	tx_put32(sum);
+	tx_flush();
+}
+
+/*
+ * Trata o comando recebido e envia a captura terminada. Deve ser chamada no laco principal; o envio bloqueia ate
+ * o ultimo bloco ser entregue ao DMA.
+ * */
+void logic_poll(void)
+{
+	if(cmd_ready)
+	{
+		logic_config_t c;
+		uint16_t pre;
+
+		c.port=rx[2]=='B'?GPIOB:GPIOA;
+		c.width=rx[3];
+		memcpy(&c.rate_hz,&rx[4],4);
+		memcpy(&c.mask,&rx[8],2);
+		memcpy(&c.value,&rx[10],2);
+		c.trigger=rx[12];
+		c.pin=rx[13];
+		memcpy(&pre,&rx[14],2);
+		c.pre=pre;
+		cmd_ready=0;
+
+		if((rx[2]!='A' && rx[2]!='B') || logic_start(&c)!=0)
+		{
+			tx_put('L');
+			tx_put('X');
+			tx_flush();
+		}
+	}
+	if(phase==LOGIC_DONE)
+	{
+		logic_send();
+		phase=LOGIC_IDLE;
+	}
+}
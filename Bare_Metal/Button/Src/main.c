@@ -17,112 +17,83 @@
  */
 
 #include <stdint.h>
-
-
+#include "stm32f1xx.h"
+#include "gpio.h"
+#include "scan.h"
+#include "logic.h"
+
+/* LEDs no GPIOC e botoes no GPIOA (entrada flutuante, apertado = 1) */
+#define LED1	(C, 13, GPIO_OUT_PP_2MHZ)
+#define LED2	(C, 14, GPIO_OUT_PP_2MHZ)
+#define LED3	(C, 15, GPIO_OUT_PP_2MHZ)
+#define BTN1	(A, 0, GPIO_IN_FLOAT)
+#define BTN2	(A, 1, GPIO_IN_FLOAT)
+#define BTN3	(A, 2, GPIO_IN_FLOAT)
+
+/* Inclui os pinos do USART1 do analisador logico (logic.h) */
+GPIO_ASSERT_DISTINCT(LED1, LED2, LED3, BTN1, BTN2, BTN3, LOGIC_USART_TX, LOGIC_USART_RX);
+
+#define BUTTONS	(GPIO_MASK(BTN1) | GPIO_MASK(BTN2) | GPIO_MASK(BTN3))
+
+/*
+ * Os botoes ficam no mesmo bit do pino (PA0 -> bit 0) e os LEDs 13 posicoes acima (PC13), entao uma
+ * mascara de botoes vira a mascara dos LEDs com um deslocamento.
+ */
+#define BTN_TO_LED(mask)	((mask) << 13)
 
 int main(void)
 {
-	/*Seta o clock no barramento APB2, para usar o GPIOC */
-	uint32_t *pRCC_APB2ENR = (uint32_t*)0x40021018;
-
-	/*
-	 * GPIO
-	 */
-	// GPIOC
-	// Saida
-	// Seta o GPIOC para high
-	uint32_t *pGPIOC_HIGH = (uint32_t*)0x40011004;
-	// Seta o GPIOC como saida (LED)
-	uint32_t *pGPIOC_OUT = (uint32_t*)0x4001100C;
-
-	// GPIOA
-	// Entrada
-	// Seta o GPIOA para low
-	uint32_t *pGPIOA_LOW = (uint32_t*)0x40010800;
-	// Seta o GPIOA como entrada (botao)
-	uint32_t *pGPIOA_INT = (uint32_t*)0x40010808;
-
-
-	//1.Seta o clock para o GPIOC
-	*pRCC_APB2ENR |= (1 << 4);
-	//1.Seta o clock para o GPIOA
-	*pRCC_APB2ENR |= (1 << 2);
-
 	/*
 	 * LEDS
-	*/
-	//  LED 1
-	//CNF13[23:22] = 00 e MODE13[21:20] = 10
-	//2a. Reseta os bits [23:20]
-	*pGPIOC_HIGH &= ~(15 << 20);
-	//2b. Seta o bit [21]
-	*pGPIOC_HIGH |= (1 << 21);
-
-	// LED 2
-	//CNF14[27:26] = 00 e MODE14[25:24] = 10
-	//2a. Reseta os bits [27:24]
-	*pGPIOC_HIGH &= ~(15 << 24);
-	//2b. Seta o bit [25]
-	*pGPIOC_HIGH |= (1 << 25);
-
-	// LED 3
-	//CNF12[31:30] = 00 e MODE12[29:28] = 10
-	//2a. Reseta os bits [19:16]
-	*pGPIOC_HIGH &= ~(15 << 28);
-	//2b. Seta o bit [29]
-	*pGPIOC_HIGH |= (1 << 29);
-
-
-
+	 * CNFy = 00 e MODEy = 10: saida push-pull, 2 MHz
+	 */
+	GPIO_CONFIG(C, LED1, LED2, LED3);
 
 	/*
 	 * Botoes
-	*/
-	//Botao 1
-	//CNF0[3:2] = 01 e MODE0[1:0] = 00
-	//2a. Reseta os bits [3:0]
-	*pGPIOA_LOW &= ~(15 << 0);
-	//2b. Seta o bit [2]
-	*pGPIOA_LOW |= (1 << 2);
-
-	//Botao 2
-	//CNF1[7:6] = 01 e MODE1[5:4] = 00
-	//2a. Reseta os bits [7:4]
-	*pGPIOA_LOW &= ~(15 << 4);
-	//2b. Seta o bit [6]
-	*pGPIOA_LOW |= (1 << 6);
-
-	//Botao 2
-	//CNF2[11:10] = 01 e MODE2[9:8] = 00
-	//2a. Reseta os bits [9:8]
-	*pGPIOA_LOW &= ~(15 << 8);
-	//2b. Seta o bit [10]
-	*pGPIOA_LOW |= (1 << 10);
-
+	 * CNFy = 01 e MODEy = 00: entrada flutuante
+	 */
+	GPIO_CONFIG(A, BTN1, BTN2, BTN3);
 
+	/*
+	 * O IDR do GPIOA e copiado por DMA a 1 kHz; debounce, bordas e aperto longo sao calculados a cada 16 ms para
+	 * os 16 pinos de uma vez. A CPU so olha os eventos prontos.
+	 */
+	static const scan_config_t scan_config =
+	{
+		.in_port = GPIOA,
+		.in_mask = BUTTONS,
+		.active_low = 0,
+		.row_port = NULL,
+		.row_bsrr = NULL,
+		.rows = 1,
+	};
+	scan_init(&scan_config);
 
+	/*
+	 * Analisador logico no USART1 (PA9/PA10): o host (Tools/la_vcd.c) pede uma captura do GPIOA ou GPIOB e recebe
+	 * as amostras comprimidas. Usa TIM3, TIM4 e os canais 3 e 4 do DMA1, separados dos do scanner.
+	 */
+	logic_init();
 
+	uint32_t leds = 0;
 	for(;;)
 	{
-		uint8_t b1 = (uint8_t)(*pGPIOA_INT & 0x1);
-		if(b1){
-			*pGPIOC_OUT |= (1<< 13);
-		}else{
-			*pGPIOC_OUT &= ~(1<< 13);
+		scan_events_t ev;
+		scan_events(&ev);
+
+		// Aperto curto alterna o LED do botao; aperto longo apaga todos
+		leds ^= ev.pressed;
+		if (ev.long_press)
+		{
+			leds = 0;
 		}
-
-		uint8_t b2 = (uint8_t)(*pGPIOA_INT & 0x2);
-		if(b2){
-				*pGPIOC_OUT |= (1<< 14);
-		}else{
-				*pGPIOC_OUT &= ~(1<< 14);
-		}
-		uint8_t b3 = (uint8_t)(*pGPIOA_INT & 0x4);
-		if(b3){
-				*pGPIOC_OUT |= (1<< 15);
-		}else{
-				*pGPIOC_OUT &= ~(1<< 15);
+		if (ev.pressed | ev.long_press)
+		{
+			// Uma unica escrita liga e desliga os tres LEDs
+			GPIOC->BSRR = BTN_TO_LED(leds) | (BTN_TO_LED(~leds & BUTTONS) << 16);
 		}
+		logic_poll();
+		__WFI();
 	}
 }
-
@@ -0,0 +1,219 @@
+#include "scan.h"
+
+/*
+ * Varredura de teclas sem interrupcao por amostra.
+ *
+ * O evento de atualizacao do TIM2 (SCAN_HZ) dispara o DMA1 canal 2, que copia o IDR inteiro da porta para um anel
+ * circular. So as interrupcoes de meio anel e anel completo acordam a CPU, e cada uma processa SCAN_RING/2 amostras
+ * de uma vez.
+ *
+ * Todo o processamento e feito em palavras de 32 bits, um bit por tecla, de forma que 3 ou 32 teclas custam o mesmo:
+ * 	- debounce por contador vertical: tres palavras c0..c2 formam um contador de 3 bits por tecla, que conta as
+ * 	  amostras seguidas diferentes do estado aceito e zera quando a tecla volta; no estouro (8 amostras) o estado
+ * 	  troca;
+ * 	- bordas: as teclas que trocaram de estado, separadas pelo novo nivel;
+ * 	- aperto longo: outro contador vertical de 4 bits, avancado a cada SCAN_LONG_MS/16, conta enquanto a tecla
+ * 	  estiver apertada e gera o evento uma unica vez por aperto.
+ *
+ * Em modo matriz o compare do canal 1 do TIM2, no meio do periodo, dispara o DMA1 canal 5, que escreve o proximo
+ * valor de row_bsrr no BSRR das linhas. A amostra seguinte (no estouro) ja ve essa linha selecionada, entao a amostra
+ * i do anel pertence a linha i % rows e a CPU nao participa do strobe.
+ * */
+
+static volatile uint16_t ring[SCAN_RING];
+
+static uint16_t invert;
+static uint16_t in_mask;
+static uint8_t rows;
+static uint8_t col_shift;
+static uint8_t col_width;
+
+static uint32_t state;			// estado aceito, 1 = apertada
+static uint32_t c0, c1, c2;		// contador vertical do debounce
+static uint32_t l0, l1, l2, l3;	// contador vertical do aperto longo
+static uint32_t long_done;		// teclas que ja geraram o aperto longo neste aperto
+static uint32_t long_div;
+static uint32_t long_reload;
+
+static scan_events_t pending;
+static uint32_t overruns;
+
+/*
+ * Configura o TIM2, o DMA e o anel. Os pinos ja devem estar configurados (entradas e, se houver matriz, as
+ * saidas das linhas). Retorna 0 em caso de sucesso ou -1 se a configuracao for invalida.
+ * */
+int scan_init(const scan_config_t *config)
+{
+	uint8_t r=config->rows?config->rows:1;
+
+	if(config->in_port==NULL || config->in_mask==0 || (SCAN_RING/2)%r || (r>1 && config->row_port==NULL))
+	{
+		return -1;
+	}
+	invert=config->active_low&config->in_mask;
+	in_mask=config->in_mask;
+	rows=r;
+	if(r>1)
+	{
+		col_shift=(uint8_t)__builtin_ctz(in_mask);
+		col_width=(uint8_t)(32-__CLZ(in_mask>>col_shift));
+		if((uint32_t)r*col_width>32 || ((in_mask>>col_shift)&((in_mask>>col_shift)+1)))
+		{
+			return -1;		// colunas demais ou nao contiguas
+		}
+	}
+	else
+	{
+		col_shift=0;
+		col_width=16;
+	}
+
+	state=c0=c1=c2=0;
+	l0=l1=l2=l3=long_done=0;
+	pending.pressed=pending.released=pending.long_press=0;
+	overruns=0;
+	long_reload=(SCAN_LONG_MS*SCAN_HZ)/(1000U*16U*r);
+	long_div=long_reload;
+
+	RCC->AHBENR|=RCC_AHBENR_DMA1EN;
+	RCC->APB1ENR|=RCC_APB1ENR_TIM2EN;
+
+	// TIM2: 1 us por contagem, estouro a SCAN_HZ (pedido de DMA no canal 2), compare 1 no meio do periodo
+	TIM2->CR1=0;
+	TIM2->PSC=(SCAN_CPU_HZ/1000000UL)-1;
+	TIM2->ARR=1000000UL/SCAN_HZ-1;
+	TIM2->CCR1=500000UL/SCAN_HZ;
+	TIM2->EGR=TIM_EGR_UG;
+	TIM2->SR=0;
+
+	// DMA1 canal 2: IDR (16 bits) -> anel, circular, interrupcao a cada meio anel
+	DMA1_Channel2->CCR=0;
+	DMA1_Channel2->CPAR=(uint32_t)&config->in_port->IDR;
+	DMA1_Channel2->CMAR=(uint32_t)ring;
+	DMA1_Channel2->CNDTR=SCAN_RING;
+	DMA1_Channel2->CCR=DMA_CCR_PL_1|DMA_CCR_MSIZE_0|DMA_CCR_PSIZE_0|DMA_CCR_MINC|DMA_CCR_CIRC|DMA_CCR_HTIE|DMA_CCR_TCIE|DMA_CCR_EN;
+	NVIC_EnableIRQ(DMA1_Channel2_IRQn);
+
+	uint32_t dier=TIM_DIER_UDE;
+	if(r>1)
+	{
+		// DMA1 canal 5: row_bsrr -> BSRR das linhas, circular, sem interrupcao
+		DMA1_Channel5->CCR=0;
+		DMA1_Channel5->CPAR=(uint32_t)&config->row_port->BSRR;
+		DMA1_Channel5->CMAR=(uint32_t)config->row_bsrr;
+		DMA1_Channel5->CNDTR=r;
+		DMA1_Channel5->CCR=DMA_CCR_PL_1|DMA_CCR_MSIZE_1|DMA_CCR_PSIZE_1|DMA_CCR_MINC|DMA_CCR_CIRC|DMA_CCR_DIR|DMA_CCR_EN;
+		dier|=TIM_DIER_CC1DE;
+	}
+	TIM2->DIER=dier;
+	TIM2->CR1=TIM_CR1_CEN;
+	return 0;
+}
+
+/* Avanca o debounce, as bordas e o aperto longo com uma amostra (um bit por tecla) */
+static void scan_step(uint32_t sample)
+{
+	uint32_t delta=sample^state;
+	uint32_t carry=delta;
+
+	c0^=carry;
+	carry&=~c0;
+	c1^=carry;
+	carry&=~c1;
+	c2^=carry;
+	carry&=~c2;
+	c0&=delta;
+	c1&=delta;
+	c2&=delta;
+
+	if(carry)
+	{
+		state^=carry;
+		pending.pressed|=carry&state;
+		pending.released|=carry&~state;
+		// Soltou: zera o contador do aperto longo
+		l0&=state;
+		l1&=state;
+		l2&=state;
+		l3&=state;
+		long_done&=state;
+	}
+
+	if(--long_div==0)
+	{
+		long_div=long_reload;
+		carry=state&~long_done;
+		l0^=carry;
+		carry&=~l0;
+		l1^=carry;
+		carry&=~l1;
+		l2^=carry;
+		carry&=~l2;
+		l3^=carry;
+		carry&=~l3;
+		long_done|=carry;
+		pending.long_press|=carry;
+	}
+}
+
+static void scan_process(const volatile uint16_t *s, uint32_t n)
+{
+	if(rows==1)
+	{
+		while(n--)
+		{
+			scan_step((*s++^invert)&in_mask);
+		}
+		return;
+	}
+	for(uint32_t i=0;i<n;i+=rows)
+	{
+		uint32_t sample=0;
+		for(uint32_t r=0;r<rows;r++)
+		{
+			sample|=(uint32_t)(((s[i+r]^invert)&in_mask)>>col_shift)<<(r*col_width);
+		}
+		scan_step(sample);
+	}
+}
+
+void DMA1_Channel2_IRQHandler(void)
+{
+	uint32_t isr=DMA1->ISR;
+
+	DMA1->IFCR=DMA_IFCR_CGIF2;
+	if((isr&DMA_ISR_HTIF2) && (isr&DMA_ISR_TCIF2))
+	{
+		// As duas metades ficaram prontas antes do processamento: uma delas ja foi sobrescrita
+		overruns++;
+	}
+	if(isr&DMA_ISR_HTIF2)
+	{
+		scan_process(&ring[0],SCAN_RING/2);
+	}
+	if(isr&DMA_ISR_TCIF2)
+	{
+		scan_process(&ring[SCAN_RING/2],SCAN_RING/2);
+	}
+}
+
+/* Estado aceito de todas as teclas (1 = apertada) */
+uint32_t scan_state(void)
+{
+	return state;
+}
+
+/* Copia e zera os eventos acumulados */
+void scan_events(scan_events_t *events)
+{
+	NVIC_DisableIRQ(DMA1_Channel2_IRQn);
+	*events=pending;
+	pending.pressed=pending.released=pending.long_press=0;
+	NVIC_EnableIRQ(DMA1_Channel2_IRQn);
+}
+
+/* Vezes em que o processamento atrasou mais de meio anel */
+uint32_t scan_overruns(void)
+{
+	return overruns;
+}
@@ -0,0 +1,288 @@
+/*
+ * Cliente do analisador logico do projeto Button (Src/logic.c) para Linux.
+ *
+ * Envia o comando de captura pela serial, recebe o fluxo RLE e grava um arquivo VCD, que pode ser aberto no
+ * GTKWave ou no PulseView.
+ *
+ * Compilar:  gcc -O2 -Wall -o la_vcd la_vcd.c
+ * Uso:       la_vcd [-p A|B] [-w 8|16] [-r taxa_hz] [-t now|rise:PINO|fall:PINO|pat:MASCARA:VALOR] [-b pre]
+ *                   /dev/ttyUSB0 saida.vcd
+ *
+ * Exemplo: botoes do Button/External_Interrupt (PA0-PA2), 100 kHz, disparo na descida do PA0, 1000 amostras antes:
+ *            la_vcd -p A -w 8 -r 100000 -t fall:0 -b 1000 /dev/ttyUSB0 botoes.vcd
+ * */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <sys/select.h>
+
+#define LA_CMD_LEN		16
+#define LA_TIMEOUT_S	30
+
+static int serial_open(const char *dev)
+{
+	int fd=open(dev,O_RDWR|O_NOCTTY);
+	if(fd<0)
+	{
+		perror(dev);
+		return -1;
+	}
+
+	struct termios tio;
+	memset(&tio,0,sizeof(tio));
+	tio.c_cflag=CS8|CREAD|CLOCAL;
+	tio.c_cc[VMIN]=1;
+	cfsetispeed(&tio,B500000);
+	cfsetospeed(&tio,B500000);
+	if(tcsetattr(fd,TCSANOW,&tio)<0)
+	{
+		perror("tcsetattr");
+		close(fd);
+		return -1;
+	}
+	tcflush(fd,TCIOFLUSH);
+	return fd;
+}
+
+/* Le exatamente n bytes ou falha depois de LA_TIMEOUT_S sem dados */
+static int read_full(int fd, uint8_t *p, size_t n)
+{
+	while(n)
+	{
+		fd_set set;
+		struct timeval tv={LA_TIMEOUT_S,0};
+		FD_ZERO(&set);
+		FD_SET(fd,&set);
+		if(select(fd+1,&set,NULL,NULL,&tv)<=0)
+		{
+			fprintf(stderr,"tempo esgotado esperando a captura\n");
+			return -1;
+		}
+		ssize_t r=read(fd,p,n);
+		if(r<=0)
+		{
+			perror("read");
+			return -1;
+		}
+		p+=r;
+		n-=(size_t)r;
+	}
+	return 0;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+	return (uint32_t)p[0]|((uint32_t)p[1]<<8)|((uint32_t)p[2]<<16)|((uint32_t)p[3]<<24);
+}
+
+static void put16(uint8_t *p, uint32_t v)
+{
+	p[0]=(uint8_t)v;
+	p[1]=(uint8_t)(v>>8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+	put16(p,v);
+	put16(p+2,v>>16);
+}
+
+static void usage(void)
+{
+	fprintf(stderr,"uso: la_vcd [-p A|B] [-w 8|16] [-r taxa_hz] [-t now|rise:PINO|fall:PINO|pat:MASCARA:VALOR] "
+			"[-b pre] dispositivo saida.vcd\n");
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	char port='A';
+	unsigned width=8;
+	unsigned long rate=100000;
+	unsigned trigger=0, pin=0, pre=0;
+	long mask=0, value=0;
+	int opt;
+
+	while((opt=getopt(argc,argv,"p:w:r:t:b:"))!=-1)
+	{
+		switch(opt)
+		{
+			case 'p': port=optarg[0]; break;
+			case 'w': width=(unsigned)atoi(optarg); break;
+			case 'r': rate=strtoul(optarg,NULL,0); break;
+			case 'b': pre=(unsigned)atoi(optarg); break;
+			case 't':
+				if(strcmp(optarg,"now")==0)
+				{
+					trigger=0;
+				}
+				else if(sscanf(optarg,"rise:%u",&pin)==1)
+				{
+					trigger=1;
+				}
+				else if(sscanf(optarg,"fall:%u",&pin)==1)
+				{
+					trigger=2;
+				}
+				else if(sscanf(optarg,"pat:%li:%li",&mask,&value)==2)
+				{
+					trigger=3;
+				}
+				else
+				{
+					usage();
+				}
+				break;
+			default: usage();
+		}
+	}
+	if(argc-optind!=2 || (port!='A' && port!='B') || (width!=8 && width!=16))
+	{
+		usage();
+	}
+
+	int fd=serial_open(argv[optind]);
+	if(fd<0)
+	{
+		return 1;
+	}
+
+	uint8_t cmd[LA_CMD_LEN]={'L','A',(uint8_t)port,(uint8_t)width};
+	put32(&cmd[4],(uint32_t)rate);
+	put16(&cmd[8],(uint32_t)mask);
+	put16(&cmd[10],(uint32_t)value);
+	cmd[12]=(uint8_t)trigger;
+	cmd[13]=(uint8_t)pin;
+	put16(&cmd[14],pre);
+	if(write(fd,cmd,sizeof(cmd))!=(ssize_t)sizeof(cmd))
+	{
+		perror("write");
+		return 1;
+	}
+
+	/* Cabecalho: 'L' 'D' porta largura taxa amostras disparo (ou 'L' 'X' se o comando foi recusado) */
+	uint8_t hdr[16];
+	if(read_full(fd,hdr,2)<0)
+	{
+		return 1;
+	}
+	if(hdr[0]=='L' && hdr[1]=='X')
+	{
+		fprintf(stderr,"comando recusado pela placa\n");
+		return 1;
+	}
+	if(hdr[0]!='L' || hdr[1]!='D' || read_full(fd,&hdr[2],14)<0)
+	{
+		fprintf(stderr,"cabecalho invalido\n");
+		return 1;
+	}
+	char hport=(char)hdr[2];
+	unsigned hwidth=hdr[3];
+	uint32_t hrate=get32(&hdr[4]);
+	uint32_t count=get32(&hdr[8]);
+	uint32_t trig=get32(&hdr[12]);
+	if(hrate!=rate)
+	{
+		fprintf(stderr,"taxa real: %u Hz\n",hrate);
+	}
+
+	FILE *out=fopen(argv[optind+1],"w");
+	if(out==NULL)
+	{
+		perror(argv[optind+1]);
+		return 1;
+	}
+
+	/* Tempo em ns; um identificador de um caractere por pino ('a' + pino) e um para o disparo */
+	double ns=1e9/(double)hrate;
+	fprintf(out,"$comment %u amostras a %u Hz, disparo na amostra %u $end\n",count,hrate,trig);
+	fprintf(out,"$timescale 1 ns $end\n$scope module P%c $end\n",hport);
+	for(unsigned b=0;b<hwidth;b++)
+	{
+		fprintf(out,"$var wire 1 %c P%c%u $end\n",'a'+b,hport,b);
+	}
+	fprintf(out,"$var wire 1 ~ TRIGGER $end\n$upscope $end\n$enddefinitions $end\n");
+
+	uint32_t sum=0, n=0, prev=0;
+	int first=1;
+	while(n<count)
+	{
+		uint8_t rec[2];
+		if(read_full(fd,rec,hwidth/8)<0)
+		{
+			return 1;
+		}
+		uint32_t sample=rec[0]|(hwidth==16?(uint32_t)rec[1]<<8:0);
+		sum+=rec[0]+(hwidth==16?rec[1]:0);
+
+		uint32_t run=0;
+		for(unsigned shift=0;;shift+=7)
+		{
+			uint8_t c;
+			if(read_full(fd,&c,1)<0)
+			{
+				return 1;
+			}
+			sum+=c;
+			run|=(uint32_t)(c&0x7F)<<shift;
+			if(!(c&0x80))
+			{
+				break;
+			}
+		}
+		if(run==0 || n+run>count)
+		{
+			fprintf(stderr,"registro RLE invalido na amostra %u\n",n);
+			return 1;
+		}
+
+		uint32_t changed=first?0xFFFFu:(sample^prev);
+		if(changed || (trig>=n && trig<n+run))
+		{
+			fprintf(out,"#%.0f\n",n*ns);
+			for(unsigned b=0;b<hwidth;b++)
+			{
+				if(changed&(1u<<b))
+				{
+					fprintf(out,"%u%c\n",(sample>>b)&1u,'a'+b);
+				}
+			}
+			if(first && trig!=n)
+			{
+				fprintf(out,"0~\n");
+			}
+		}
+		if(trig>n && trig<n+run)
+		{
+			fprintf(out,"#%.0f\n",trig*ns);
+		}
+		if(trig>=n && trig<n+run)
+		{
+			fprintf(out,"1~\n");
+		}
+		prev=sample;
+		first=0;
+		n+=run;
+	}
+	fprintf(out,"#%.0f\n",count*ns);
+	fclose(out);
+
+	uint8_t tail[6];
+	if(read_full(fd,tail,sizeof(tail))<0)
+	{
+		return 1;
+	}
+	if(tail[0]!='L' || tail[1]!='E' || get32(&tail[2])!=sum)
+	{
+		fprintf(stderr,"soma de verificacao nao confere, arquivo pode estar corrompido\n");
+		return 1;
+	}
+	printf("%u amostras gravadas em %s\n",count,argv[optind+1]);
+	close(fd);
+	return 0;
+}
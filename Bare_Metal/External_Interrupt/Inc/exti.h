@@ -0,0 +1,36 @@
+#ifndef EXTI_H_
+#define EXTI_H_
+
+#include "stdint.h"
+#include "stddef.h"
+#include "stm32f1xx.h"
+
+/* Clock do nucleo (HSI de 8 MHz, sem PLL): base do carimbo de tempo (DWT->CYCCNT) e do TIM2 */
+#define EXTI_CPU_HZ				8000000UL
+#define EXTI_CYCLES_PER_MS		(EXTI_CPU_HZ/1000UL)
+
+/* Periodo do TIM2 que avanca o debounce. So conta enquanto alguma linha estiver em debounce. */
+#define EXTI_TICK_MS			1U
+
+/* Prioridade unica dos vetores EXTI e do TIM2: um nunca interrompe o outro, entao a tabela nao precisa de trava */
+#define EXTI_IRQ_PRIO			2U
+
+#define EXTI_LINES				16U
+
+/* Bordas que geram evento */
+#define EXTI_EDGE_RISING		0x01U
+#define EXTI_EDGE_FALLING		0x02U
+#define EXTI_EDGE_BOTH			(EXTI_EDGE_RISING|EXTI_EDGE_FALLING)
+
+/*
+ * Chamado com o nivel estavel do pino depois do debounce (ou direto da ISR se debounce_ms = 0). stamp e o
+ * DWT->CYCCNT da primeira borda, ou seja, o instante real do evento e nao o fim da janela de debounce.
+ * */
+typedef void (*exti_handler_t)(uint8_t line, uint8_t level, uint32_t stamp, void *ctx);
+
+void exti_init(void);
+int exti_register(GPIO_TypeDef *port, uint8_t line, uint8_t edges, uint16_t debounce_ms, exti_handler_t handler, void *ctx);
+void exti_unregister(uint8_t line);
+uint32_t exti_bounces(uint8_t line);
+
+#endif /* EXTI_H_ */
@@ -0,0 +1,267 @@
+#include "exti.h"
+
+/*
+ * Despachante das linhas EXTI 0 a 15.
+ *
+ * Todos os vetores (EXTI0 a EXTI4, EXTI9_5 e EXTI15_10) caem em exti_irq() com a mascara das linhas que atendem.
+ * Cada bit pendente e tratado com um CLZ e um acesso a tabela, sem percorrer as 16 entradas.
+ *
+ * Sem debounce a ISR chama o handler na hora. Com debounce a primeira borda so guarda o instante (DWT->CYCCNT),
+ * mascara a linha no IMR para que o repique nao gere mais interrupcoes e liga o TIM2. A cada tick do TIM2 as linhas
+ * cuja janela acabou tem o pino lido de novo: se o nivel estavel mudou, o handler e chamado; em seguida a linha e
+ * desmascarada. O TIM2 para sozinho quando nenhuma linha esta em debounce.
+ *
+ * Com debounce as duas bordas ficam ligadas no hardware, mesmo que so uma gere evento, para que o nivel estavel
+ * acompanhe tambem a soltura do botao.
+ * */
+
+typedef struct
+{
+	GPIO_TypeDef *port;
+	exti_handler_t handler;
+	void *ctx;
+	uint32_t stamp;
+	uint32_t window;		// janela de debounce em ciclos (0 = sem debounce)
+	uint32_t bounces;		// bordas descartadas pelo debounce
+	uint8_t edges;
+	uint8_t level;			// ultimo nivel estavel
+} exti_line_t;
+
+static exti_line_t lines[EXTI_LINES];
+static volatile uint32_t debouncing;
+
+static const IRQn_Type line_irq[EXTI_LINES]=
+{
+	EXTI0_IRQn,EXTI1_IRQn,EXTI2_IRQn,EXTI3_IRQn,EXTI4_IRQn,
+	EXTI9_5_IRQn,EXTI9_5_IRQn,EXTI9_5_IRQn,EXTI9_5_IRQn,EXTI9_5_IRQn,
+	EXTI15_10_IRQn,EXTI15_10_IRQn,EXTI15_10_IRQn,EXTI15_10_IRQn,EXTI15_10_IRQn,EXTI15_10_IRQn
+};
+
+static inline uint8_t exti_level(const exti_line_t *l, uint32_t line)
+{
+	return (l->port->IDR>>line)&1U;
+}
+
+static inline void exti_dispatch(exti_line_t *l, uint32_t line, uint8_t level)
+{
+	if(l->edges&(level?EXTI_EDGE_RISING:EXTI_EDGE_FALLING))
+	{
+		l->handler((uint8_t)line,level,l->stamp,l->ctx);
+	}
+}
+
+/*
+ * Liga o contador de ciclos para os carimbos de tempo e prepara o TIM2 (sem ligar o contador) e o AFIO.
+ * Deve ser chamada antes de exti_register().
+ * */
+void exti_init(void)
+{
+	CoreDebug->DEMCR|=CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL|=DWT_CTRL_CYCCNTENA_Msk;
+
+	// AFIO guarda no EXTICR a porta de cada linha (secao 9.4.3)
+	RCC->APB2ENR|=RCC_APB2ENR_AFIOEN;
+	RCC->APB1ENR|=RCC_APB1ENR_TIM2EN;
+
+	EXTI->IMR&=~((1UL<<EXTI_LINES)-1);
+	EXTI->PR=(1UL<<EXTI_LINES)-1;
+	debouncing=0;
+
+	TIM2->CR1=TIM_CR1_URS;			// so o estouro gera interrupcao, nao o UG abaixo
+	TIM2->PSC=(EXTI_CPU_HZ/1000000UL)-1;	// 1 us por contagem
+	TIM2->ARR=EXTI_TICK_MS*1000U-1;
+	TIM2->EGR=TIM_EGR_UG;
+	TIM2->DIER=TIM_DIER_UIE;
+	NVIC_SetPriority(TIM2_IRQn,EXTI_IRQ_PRIO);
+	NVIC_EnableIRQ(TIM2_IRQn);
+}
+
+/*
+ * Associa a linha (pino) do port ao handler. Substitui um registro anterior da mesma linha, inclusive de outra
+ * porta: o EXTI tem uma so linha por numero de pino. O pino ja deve estar configurado como entrada.
+ * Retorna 0 em caso de sucesso ou -1 se os parametros forem invalidos.
+ * */
+int exti_register(GPIO_TypeDef *port, uint8_t line, uint8_t edges, uint16_t debounce_ms, exti_handler_t handler, void *ctx)
+{
+	if(line>=EXTI_LINES || handler==NULL || (edges&EXTI_EDGE_BOTH)==0)
+	{
+		return -1;
+	}
+	uint32_t bit=1UL<<line;
+	uint32_t port_index=((uint32_t)port-GPIOA_BASE)/(GPIOB_BASE-GPIOA_BASE);
+	exti_line_t *l=&lines[line];
+
+	exti_unregister(line);
+
+	uint32_t primask=__get_PRIMASK();
+	__disable_irq();
+	l->port=port;
+	l->handler=handler;
+	l->ctx=ctx;
+	l->window=debounce_ms*EXTI_CYCLES_PER_MS;
+	l->bounces=0;
+	l->edges=edges;
+	l->level=exti_level(l,line);
+
+	// Porta da linha no AFIO_EXTICRx (4 bits por linha, 0000 = PA, 0001 = PB...)
+	uint32_t shift=(line&3U)*4U;
+	AFIO->EXTICR[line>>2]=(AFIO->EXTICR[line>>2]&~(0xFUL<<shift))|(port_index<<shift);
+
+	// Bordas no RTSR/FTSR (secoes 10.3.3 e 10.3.4)
+	uint8_t hw_edges=l->window?EXTI_EDGE_BOTH:edges;
+	EXTI->RTSR=(hw_edges&EXTI_EDGE_RISING)?(EXTI->RTSR|bit):(EXTI->RTSR&~bit);
+	EXTI->FTSR=(hw_edges&EXTI_EDGE_FALLING)?(EXTI->FTSR|bit):(EXTI->FTSR&~bit);
+
+	// Limpa o pendente antigo e desmascara a linha (secao 10.3.1)
+	EXTI->PR=bit;
+	EXTI->IMR|=bit;
+	__set_PRIMASK(primask);
+
+	NVIC_SetPriority(line_irq[line],EXTI_IRQ_PRIO);
+	NVIC_EnableIRQ(line_irq[line]);
+	return 0;
+}
+
+/* Mascara a linha e a retira da tabela. O vetor do NVIC continua ligado (pode ser compartilhado). */
+void exti_unregister(uint8_t line)
+{
+	if(line>=EXTI_LINES)
+	{
+		return;
+	}
+	uint32_t bit=1UL<<line;
+	uint32_t primask=__get_PRIMASK();
+
+	// IMR e debouncing tambem sao alterados pelas ISRs
+	__disable_irq();
+	EXTI->IMR&=~bit;
+	EXTI->PR=bit;
+	debouncing&=~bit;
+	lines[line].handler=NULL;
+	__set_PRIMASK(primask);
+}
+
+/* Quantidade de bordas que chegaram durante a janela de debounce e foram descartadas */
+uint32_t exti_bounces(uint8_t line)
+{
+	return line<EXTI_LINES?lines[line].bounces:0;
+}
+
+static void exti_irq(uint32_t mask)
+{
+	uint32_t now=DWT->CYCCNT;
+	// So as linhas habilitadas: uma linha mascarada (em debounce) que divide o vetor fica com o PR para o tick do TIM2
+	uint32_t pending=EXTI->PR&EXTI->IMR&mask;
+
+	EXTI->PR=pending;
+	while(pending)
+	{
+		uint32_t line=31U-__CLZ(pending);
+		uint32_t bit=1UL<<line;
+		exti_line_t *l=&lines[line];
+		pending&=~bit;
+
+		if(l->handler==NULL)
+		{
+			continue;
+		}
+		l->stamp=now;
+		if(l->window==0)
+		{
+			exti_dispatch(l,line,exti_level(l,line));
+			continue;
+		}
+		// Primeira borda: a linha fica mascarada ate o fim da janela
+		EXTI->IMR&=~bit;
+		debouncing|=bit;
+	}
+	if(debouncing)
+	{
+		TIM2->CR1|=TIM_CR1_CEN;
+	}
+}
+
+void TIM2_IRQHandler(void)
+{
+	uint32_t now=DWT->CYCCNT;
+	uint32_t active=debouncing;
+
+	TIM2->SR=~TIM_SR_UIF;
+	while(active)
+	{
+		uint32_t line=31U-__CLZ(active);
+		uint32_t bit=1UL<<line;
+		exti_line_t *l=&lines[line];
+		active&=~bit;
+
+		if((uint32_t)(now-l->stamp)<l->window)
+		{
+			if(EXTI->PR&bit)
+			{
+				// Repique que chegou a marcar o PR com a linha mascarada: so entra na estatistica
+				EXTI->PR=bit;
+				l->bounces++;
+			}
+			continue;
+		}
+
+		uint8_t level=exti_level(l,line);
+		debouncing&=~bit;
+		if(level!=l->level)
+		{
+			l->level=level;
+			exti_dispatch(l,line,level);
+		}
+
+		EXTI->PR=bit;
+		if(exti_level(l,line)!=l->level)
+		{
+			// O pino mudou de novo depois da leitura: abre outra janela em vez de esperar uma borda que ja passou
+			l->stamp=now;
+			debouncing|=bit;
+		}
+		else
+		{
+			EXTI->IMR|=bit;
+		}
+	}
+	if(!debouncing)
+	{
+		TIM2->CR1&=~TIM_CR1_CEN;
+	}
+}
+
+void EXTI0_IRQHandler(void)
+{
+	exti_irq(EXTI_PR_PR0);
+}
+
+void EXTI1_IRQHandler(void)
+{
+	exti_irq(EXTI_PR_PR1);
+}
+
+void EXTI2_IRQHandler(void)
+{
+	exti_irq(EXTI_PR_PR2);
+}
+
+void EXTI3_IRQHandler(void)
+{
+	exti_irq(EXTI_PR_PR3);
+}
+
+void EXTI4_IRQHandler(void)
+{
+	exti_irq(EXTI_PR_PR4);
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+	exti_irq(0x03E0UL);
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+	exti_irq(0xFC00UL);
+}
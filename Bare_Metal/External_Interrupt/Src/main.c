@@ -23,35 +23,33 @@
 #endif
 
 #include "stm32f1xx.h"
+#include "gpio.h"
+#include "exti.h"
 
-/*
- * EXTI0 external interrupt handler
- */
-void EXTI0_IRQHandler(void)
-{
-	GPIOB->ODR ^= (1<<8);
-	// Clear pending
-	EXTI->PR = (1 << 0);
+/* Botoes (ativos em nivel baixo, pull-up interno) e LEDs */
+#define BTN1	(A, 0, GPIO_IN_PULLUP)
+#define BTN2	(A, 1, GPIO_IN_PULLUP)
+#define BTN3	(A, 2, GPIO_IN_PULLUP)
+#define LED1	(B, 8, GPIO_OUT_PP_2MHZ)
+#define LED2	(B, 9, GPIO_OUT_PP_2MHZ)
+#define LED3	(B, 10, GPIO_OUT_PP_2MHZ)
 
-}
-/*
- * EXTI1 external interrupt handler
- */
+GPIO_ASSERT_DISTINCT(BTN1, BTN2, BTN3, LED1, LED2, LED3);
 
-void EXTI1_IRQHandler(void)
-{
-	// Do stuff
-	GPIOB->ODR ^= (1 << 9);
-	// Clear pending
-	EXTI->PR = (1 << 1);
-}
+/* Tempo que o nivel do botao precisa ficar estavel para contar como um aperto */
+#define BTN_DEBOUNCE_MS	20
 
-void EXTI2_IRQHandler(void)
+/*
+ * Chamado pelo despachante do EXTI (contexto de interrupcao do TIM2) uma vez por aperto, depois do debounce
+ */
+static void button_pressed(uint8_t line, uint8_t level, uint32_t stamp, void *ctx)
 {
-	// Do stuff
-	GPIOB->ODR ^= (1 << 10);
-	// Clear pending
-	EXTI->PR = (1 << 2);
+	switch (line)
+	{
+		case 0: GPIO_TOGGLE(LED1); break;
+		case 1: GPIO_TOGGLE(LED2); break;
+		case 2: GPIO_TOGGLE(LED3); break;
+	}
 }
 
 
@@ -63,164 +61,41 @@ int main(void)
 	 * Clock dos Perifericos
 	 */
 
-	//habilite para usa o GPIOB clock
-	RCC->APB2ENR |= (1 << 3);
-
-	//habilite para usa o GPIOA clock
-	RCC->APB2ENR |= (1 << 2);
-
 	/*
 	 * Input
 	 * Para habilita um pino como entrada leia a secaoo 9.2.1.Port configuration register low
-	 *Botao
-	 *
+	 * Botao: CNFy = 10 e MODEy = 00 (input with pull-up / pull-down). O ODR escolhe o pull (1 -> pull-up),
+	 * veja a Table 20. Port bit configuration table. GPIO_CONFIG liga o clock do GPIOA, escreve o ODR pelo BSRR
+	 * e grava o CRL uma unica vez.
 	*/
-
-	// B1
-	////CNF0[3:2] = 10 e MODE0[1:0] = 00
-	// 10: Input with pull-up / pull-down
-	//2a. Reseta os bits [3:0]
-	GPIOA->CRL &= 0xFFFFFFF0; // binario - 11111111111111111111111111110000
-	//2b. Seta o bit [3]
-	GPIOA->CRL |= 0xFFFFFFF8;
-
-	//3. Configure the ODR (1-> Pull UP, 0-> Pull down)
-	// Olha a tabela com essa especificacao -> Table 20. Port bit configuration table
-	//Para habilita pull-up no Input precisa configurar o registrador ODR para 1
-	GPIOA->ODR |= (1<<0);
-
-
-	// B2
-	////CNF1[7:6] = 10 e MODE1[5:4] = 00
-	// 10: Input with pull-up / pull-down
-	//2a. Reseta os bits [7:0]
-	GPIOA->CRL &= 0xFFFFFF0F; // binario - 11111111111111111111111100001111
-	//2b. Seta o bit [7]
-	GPIOA->CRL |= 0xFFFFFF80;
-
-	//3. Configure the ODR (1-> Pull UP, 0-> Pull down)
-	// Olha a tabela com essa especificacao -> Table 20. Port bit configuration table
-	//Para habilita pull-up no Input precisa configurar o registrador ODR para 1
-	GPIOA->ODR |= (1<<1);
-
-
-	// B3
-	////CNF2[11:10] = 10 e MODE2[9:8] = 00
-	// 10: Input with pull-up / pull-down
-	//2a. Reseta os bits [7:0]
-	GPIOA->CRL &= 0xFFFFF0FF; // binario - 11111111111111111111000011111111
-	//2b. Seta o bit [7]
-	GPIOA->CRL |= 0xFFFFF800;
-
-	//3. Configure the ODR (1-> Pull UP, 0-> Pull down)
-	// Olha a tabela com essa especificacao -> Table 20. Port bit configuration table
-	//Para habilita pull-up no Input precisa configurar o registrador ODR para 1
-	GPIOA->ODR |= (1<<2);
+	GPIO_CONFIG(A, BTN1, BTN2, BTN3);
 
 	/*
-		 * Output
-		 * Para habilita um pino como saida olhe a secaoo 9.2.2 Port configuration register high (GPIOx_CRH)
-		 * LED
-		 *
+	 * Output
+	 * Para habilita um pino como saida olhe a secaoo 9.2.2 Port configuration register high (GPIOx_CRH)
+	 * LED: CNFy = 00 e MODEy = 10 (push-pull, 2 MHz)
 	*/
-	//LED1
-	//CNF8[3:2] = 00 e MODE8[1:0] = 10
-	GPIOB->CRH &= 0xFFFFFF0; // binario - 11111111111111111111111111110000
-	//habilita o bit [1]
-	GPIOB->CRH |= (1<<1);
-
-	// Reset GPIOB Pin8
-	GPIOB->ODR &= ~(1<<8);
-
+	GPIO_CONFIG(B, LED1, LED2, LED3);
 
-	//LED2
-	//CNF9[7:6] = 00 e MODE9[5:4] = 10
-	GPIOB->CRH &= 0xFFFFF0F; // binario - 11111111111111111111111100001111
-	//habilita o bit [5]
-	GPIOB->CRH |= (1<<5);
-
-	// Reset GPIOB Pin9
-	GPIOB->ODR &= ~(1<<9);
-
-
-	//LED3
-	//CNF10[11:10] = 00 e MODE10[9:8] = 10
-	GPIOB->CRH &= 0xFFFF0FF; // binario - 11111111111111111111000011111111
-	//habilita o bit [5]
-	GPIOB->CRH |= (1<<9);
-
-	// Reset GPIOB Pin9
-	GPIOB->ODR &= ~(1<<10);
+	// Reset GPIOB Pin8, Pin9 e Pin10 em uma unica escrita
+	GPIOB->BRR = GPIO_MASK(LED1) | GPIO_MASK(LED2) | GPIO_MASK(LED3);
 
 
 	/*************>>>>>>> External Interrupt <<<<<<<<************
 
-	1. Enable the AFIO bit in RCC register
-	2. Configure the EXTI configuration Register in the AFIO
-	3. Disable the EXTI Mask using Interrupt Mask Register (IMR)
-	4. Configure the Rising Edge / Falling Edge Trigger
-	5. Set the Interrupt Priority
-	6. Enable the interrupt
+	exti_init() liga o AFIO (secao 8.3.7) e o TIM2 do debounce. exti_register() faz, para cada linha:
+	1. Configure the EXTI configuration Register in the AFIO (secao 9.4.3, 0000: PA[x] pin)
+	2. Configure the Rising Edge / Falling Edge Trigger (secoes 10.3.3 e 10.3.4)
+	3. Disable the EXTI Mask using Interrupt Mask Register (secao 10.3.1)
+	4. Set the Interrupt Priority and enable the interrupt
 
-	********************************************************/
+	Os botoes sao ativos em nivel baixo: o aperto e a borda de descida.
 
-	//1. Enable the AFIO bit in RCC register
-	// habilita o AFIO bit do RCC register na secao 8.3.7
-	RCC->APB2ENR |= (1<<0);
-
-	//2. Configure the EXTI configuration Register in the AFIO
-	// habilita AFIO na secao 9.4.3.External interrupt configuration register 1
-	// habilita 0000: PA[x] pin
-	// EXTI0
-	AFIO->EXTICR[0] &= ~(0xf<<0);
-
-	// EXTI1
-	AFIO->EXTICR[0] &= ~(0xf<<4);
-
-	// EXTI2
-	AFIO->EXTICR[0] &= ~(0xf<<8);
-
-
-	//4. Configure the  Falling Edge Trigger
-	// Para habilita a borda de descida utilize a secao 10.3.4 Falling trigger selection register (EXTI_FTSR)
-	// habilite 1: Falling trigger enabled (for Event and Interrupt) for input line.
-	//PINO A0
-	EXTI->FTSR |= (1<<0);  // Enable Falling Edge Trigger
-
-	//PINO A1
-	EXTI->FTSR |= (1<<1);  // Enable Falling Edge Trigger
-
-	//PINO A2
-	EXTI->FTSR |= (1<<2);  // Enable Falling Edge Trigger
-
-
-
-	//3. Disable the EXTI Mask using Interrupt Mask Register (IMR)
-	// Para desabilita a mascara de interrupcao utilize a secao e 10.3.1 Interrupt mask register (EXTI_IMR)
-	// habilita 1: Interrupt request from Line x is not masked
-	EXTI->IMR |= (1<<0); // Mask EXTI0
-
-	EXTI->IMR |= (1<<1); // Mask EXTI1
-
-	EXTI->IMR |= (1<<2); // Mask EXTI2
-
-	//5. Set the Interrupt Priority
-	NVIC_SetPriority(EXTI0_IRQn,1);
-
-	//5. Set the Interrupt Priority
-	NVIC_SetPriority(EXTI1_IRQn,2);
-
-	//5. Set the Interrupt Priority
-	NVIC_SetPriority(EXTI2_IRQn,3);
-
-	//6. Enable the interrupt
-	NVIC_EnableIRQ(EXTI0_IRQn);
-
-	//6. Enable the interrupt
-	NVIC_EnableIRQ(EXTI1_IRQn);
-
-	//6. Enable the interrupt
-	NVIC_EnableIRQ(EXTI2_IRQn);
+	********************************************************/
+	exti_init();
+	exti_register(GPIOA, 0, EXTI_EDGE_FALLING, BTN_DEBOUNCE_MS, button_pressed, NULL);
+	exti_register(GPIOA, 1, EXTI_EDGE_FALLING, BTN_DEBOUNCE_MS, button_pressed, NULL);
+	exti_register(GPIOA, 2, EXTI_EDGE_FALLING, BTN_DEBOUNCE_MS, button_pressed, NULL);
 
 	__enable_irq();
 
@@ -5,24 +5,57 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Src/at24c32.c \
+../Src/bme280.c \
+../Src/ds3231.c \
+../Src/eelog.c \
 ../Src/i2c.c \
+../Src/i2c_sched.c \
 ../Src/main.c \
+../Src/mempool.c \
+../Src/mpu6050.c \
+../Src/oled.c \
+../Src/stack.c \
 ../Src/syscalls.c \
 ../Src/sysmem.c \
+../Src/timebase.c \
+../Src/timeconv.c \
 ../Src/uart.c 
 
 OBJS += \
+./Src/at24c32.o \
+./Src/bme280.o \
+./Src/ds3231.o \
+./Src/eelog.o \
 ./Src/i2c.o \
+./Src/i2c_sched.o \
 ./Src/main.o \
+./Src/mempool.o \
+./Src/mpu6050.o \
+./Src/oled.o \
+./Src/stack.o \
 ./Src/syscalls.o \
 ./Src/sysmem.o \
+./Src/timebase.o \
+./Src/timeconv.o \
 ./Src/uart.o 
 
 C_DEPS += \
+./Src/at24c32.d \
+./Src/bme280.d \
+./Src/ds3231.d \
+./Src/eelog.d \
 ./Src/i2c.d \
+./Src/i2c_sched.d \
 ./Src/main.d \
+./Src/mempool.d \
+./Src/mpu6050.d \
+./Src/oled.d \
+./Src/stack.d \
 ./Src/syscalls.d \
 ./Src/sysmem.d \
+./Src/timebase.d \
+./Src/timeconv.d \
 ./Src/uart.d 
 
 
@@ -33,7 +66,7 @@ Src/%.o Src/%.su Src/%.cyclo: ../Src/%.c Src/subdir.mk
 clean: clean-Src
 
 clean-Src:
-	-$(RM) ./Src/i2c.cyclo ./Src/i2c.d ./Src/i2c.o ./Src/i2c.su ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su ./Src/uart.cyclo ./Src/uart.d ./Src/uart.o ./Src/uart.su
+	-$(RM) ./Src/at24c32.cyclo ./Src/at24c32.d ./Src/at24c32.o ./Src/at24c32.su ./Src/bme280.cyclo ./Src/bme280.d ./Src/bme280.o ./Src/bme280.su ./Src/ds3231.cyclo ./Src/ds3231.d ./Src/ds3231.o ./Src/ds3231.su ./Src/eelog.cyclo ./Src/eelog.d ./Src/eelog.o ./Src/eelog.su ./Src/i2c.cyclo ./Src/i2c.d ./Src/i2c.o ./Src/i2c.su ./Src/i2c_sched.cyclo ./Src/i2c_sched.d ./Src/i2c_sched.o ./Src/i2c_sched.su ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/mempool.cyclo ./Src/mempool.d ./Src/mempool.o ./Src/mempool.su ./Src/mpu6050.cyclo ./Src/mpu6050.d ./Src/mpu6050.o ./Src/mpu6050.su ./Src/oled.cyclo ./Src/oled.d ./Src/oled.o ./Src/oled.su ./Src/stack.cyclo ./Src/stack.d ./Src/stack.o ./Src/stack.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su ./Src/timebase.cyclo ./Src/timebase.d ./Src/timebase.o ./Src/timebase.su ./Src/timeconv.cyclo ./Src/timeconv.d ./Src/timeconv.o ./Src/timeconv.su ./Src/uart.cyclo ./Src/uart.d ./Src/uart.o ./Src/uart.su
 
 .PHONY: clean-Src
 
@@ -0,0 +1,17 @@
+#ifndef AT24C32_H_
+#define AT24C32_H_
+
+#include "stdint.h"
+
+#define AT24C32_ADDR		0x57		// A2..A0 em 1 nos modulos DS3231 comuns
+#define AT24C32_SIZE		4096U
+#define AT24C32_PAGE		32U
+
+/* Quantas vezes o dispositivo e testado (~0,1 ms cada a 100 kHz) antes de desistir; o ciclo de escrita dura ate 10 ms */
+#define AT24C32_POLL_MAX	200U
+
+int at24c32_wait_ready(void);
+int at24c32_read(uint16_t addr, uint8_t *data, uint16_t length);
+int at24c32_write(uint16_t addr, const uint8_t *data, uint16_t length);
+
+#endif /* AT24C32_H_ */
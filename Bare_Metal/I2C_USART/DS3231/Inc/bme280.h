@@ -0,0 +1,59 @@
+#ifndef BME280_H_
+#define BME280_H_
+
+#include "stdint.h"
+
+#define BME280_ADDR				0x76	// SDO em GND; com SDO em VCC o endereco e 0x77
+
+/* Registradores do BME280 */
+#define BME280_REG_CALIB00		0x88	// 0x88-0xA1: calibracao de temperatura e pressao (+ dig_H1)
+#define BME280_REG_CHIP_ID		0xD0
+#define BME280_REG_CALIB26		0xE1	// 0xE1-0xE7: calibracao de umidade
+#define BME280_REG_CTRL_HUM		0xF2
+#define BME280_REG_STATUS		0xF3
+#define BME280_REG_CTRL_MEAS	0xF4
+#define BME280_REG_CONFIG		0xF5
+#define BME280_REG_DATA			0xF7	// 0xF7-0xFE: pressao, temperatura e umidade brutas
+
+#define BME280_CHIP_ID			0x60
+#define BME280_DATA_LEN			8
+
+/* Uma conversao forcada com oversampling x1 nas tres grandezas leva no maximo 9,3 ms */
+#define BME280_MIN_PERIOD_MS	10
+
+/* Coeficientes de calibracao gravados no chip, com os nomes do datasheet */
+typedef struct
+{
+	uint16_t dig_T1;
+	int16_t dig_T2;
+	int16_t dig_T3;
+	uint16_t dig_P1;
+	int16_t dig_P2;
+	int16_t dig_P3;
+	int16_t dig_P4;
+	int16_t dig_P5;
+	int16_t dig_P6;
+	int16_t dig_P7;
+	int16_t dig_P8;
+	int16_t dig_P9;
+	uint8_t dig_H1;
+	int16_t dig_H2;
+	uint8_t dig_H3;
+	int16_t dig_H4;
+	int16_t dig_H5;
+	int8_t dig_H6;
+} bme280_calib_t;
+
+typedef struct
+{
+	int32_t temperature;	// centesimos de grau Celsius
+	uint32_t pressure;		// Pa em Q24.8 (pressure/256 = Pa)
+	uint32_t humidity;		// %UR em Q22.10 (humidity/1024 = %)
+	uint32_t timestamp;		// instante da leitura em ciclos de timebase_cycles()
+} bme280_data_t;
+
+int bme280_init(uint8_t saddr, uint16_t period_ms);
+int bme280_get(bme280_data_t *data);
+void bme280_compensate(const bme280_calib_t *calib, const uint8_t raw[BME280_DATA_LEN], bme280_data_t *data);
+
+#endif /* BME280_H_ */
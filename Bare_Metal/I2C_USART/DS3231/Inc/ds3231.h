@@ -0,0 +1,104 @@
+#ifndef DS3231_H_
+#define DS3231_H_
+
+#include "stdint.h"
+
+#define DS3231_ADDR			0x68
+
+/* Registradores do DS3231 */
+#define DS3231_REG_SECONDS	0x00
+#define DS3231_REG_ALARM1	0x07
+#define DS3231_REG_ALARM2	0x0B
+#define DS3231_REG_CONTROL	0x0E
+#define DS3231_REG_STATUS	0x0F
+#define DS3231_REG_AGING	0x10
+#define DS3231_REG_TEMP_MSB	0x11
+#define DS3231_REG_TEMP_LSB	0x12
+#define DS3231_NUM_REGS		19
+
+/* Bits do registrador de controle */
+#define DS3231_CTRL_A1IE	(1U<<0)
+#define DS3231_CTRL_A2IE	(1U<<1)
+#define DS3231_CTRL_INTCN	(1U<<2)
+#define DS3231_CTRL_RS1		(1U<<3)
+#define DS3231_CTRL_RS2		(1U<<4)
+#define DS3231_CTRL_CONV	(1U<<5)
+#define DS3231_CTRL_BBSQW	(1U<<6)
+#define DS3231_CTRL_EOSC	(1U<<7)
+
+/* Bits do registrador de status */
+#define DS3231_STAT_A1F		(1U<<0)
+#define DS3231_STAT_A2F		(1U<<1)
+#define DS3231_STAT_BSY		(1U<<2)
+#define DS3231_STAT_EN32KHZ	(1U<<3)
+#define DS3231_STAT_OSF		(1U<<7)
+
+/* O relogio de software e conferido com o chip pelo menos uma vez a cada DS3231_RESYNC_S segundos */
+#define DS3231_RESYNC_S		3600U
+
+/* Pino que recebe a saida SQW/INT (dreno aberto, usa o pull-up interno): PB0 -> EXTI0 */
+#define DS3231_SQW_PIN		0
+
+typedef struct
+{
+	uint8_t seconds;	// 0-59
+	uint8_t minutes;	// 0-59
+	uint8_t hours;		// 0-23
+	uint8_t day;		// dia da semana 1-7
+	uint8_t date;		// dia do mes 1-31
+	uint8_t month;		// 1-12
+	uint16_t year;		// 2000-2199
+} ds3231_time_t;
+
+/*
+ * Modo de disparo dos alarmes: quais campos precisam coincidir. O alarme 2 nao tem segundos, entao para ele
+ * DS3231_ALARM_EVERY e DS3231_ALARM_MATCH_S disparam uma vez por minuto (em hh:mm:00).
+ * */
+typedef enum
+{
+	DS3231_ALARM_OFF,
+	DS3231_ALARM_EVERY,			// todo segundo (alarme 1) / todo minuto (alarme 2)
+	DS3231_ALARM_MATCH_S,		// segundos
+	DS3231_ALARM_MATCH_MS,		// minutos e segundos
+	DS3231_ALARM_MATCH_HMS,		// horas, minutos e segundos
+	DS3231_ALARM_MATCH_DATE,	// dia do mes, horas, minutos e segundos
+	DS3231_ALARM_MATCH_DAY		// dia da semana, horas, minutos e segundos
+} ds3231_alarm_mode_t;
+
+typedef struct
+{
+	ds3231_alarm_mode_t mode;
+	uint8_t seconds;
+	uint8_t minutes;
+	uint8_t hours;
+	uint8_t day_date;			// dia do mes (MATCH_DATE) ou dia da semana (MATCH_DAY)
+} ds3231_alarm_t;
+
+/* Copia decodificada de todos os 19 registradores, lida em uma unica rajada */
+typedef struct
+{
+	uint8_t raw[DS3231_NUM_REGS];
+	ds3231_time_t time;
+	ds3231_alarm_t alarm1;
+	ds3231_alarm_t alarm2;
+	uint8_t control;
+	uint8_t status;
+	int8_t aging;
+	int16_t temperature;		// centesimos de grau Celsius (resolucao de 0,25 C)
+} ds3231_snapshot_t;
+
+int ds3231_init(void);
+void ds3231_service(void);
+void ds3231_now(ds3231_time_t *time, uint32_t *us);
+uint32_t ds3231_resync_count(void);
+
+void ds3231_snapshot(ds3231_snapshot_t *snap);
+void ds3231_set_time(const ds3231_time_t *time);
+void ds3231_set_alarms(const ds3231_alarm_t *alarm1, const ds3231_alarm_t *alarm2, uint8_t int_output);
+void ds3231_set_alarm_callback(void (*callback)(uint8_t flags));
+int16_t ds3231_temperature(void);
+int ds3231_start_conversion(void);
+int ds3231_conversion_done(void);
+int ds3231_set_aging(int8_t offset);
+
+#endif /* DS3231_H_ */
@@ -0,0 +1,16 @@
+#ifndef EELOG_H_
+#define EELOG_H_
+
+#include "stdint.h"
+
+#define EELOG_MAX_PAYLOAD	64U		// maior registro aceito por eelog_append()
+#define EELOG_FIRST			8U		// enderecos 0-7: dois cabecalhos com o numero de geracao do log
+
+int eelog_init(void);
+int eelog_append(const void *payload, uint8_t length);
+int eelog_read(uint16_t *cursor, void *payload, uint8_t max);
+int eelog_clear(void);
+uint16_t eelog_count(void);
+uint16_t eelog_free(void);
+
+#endif /* EELOG_H_ */
@@ -3,15 +3,132 @@
 #define I2C_H_
 #include "stdint.h"
 #include "stdio.h"
+#include "stm32f1xx.h"
 
+/* Numero maximo de leituras de SR1 antes de desistir de esperar uma flag */
+#define I2C_TIMEOUT		20000U
 
-void i2c_init();
-void i2c1_scan_bus(void);
-void i2c1_MemoryWrite_Byte(uint8_t saddr,uint8_t maddr, uint8_t data);
-void i2c1_Write_Byte(uint8_t saddr, uint8_t data);
-void i2c1_readMemoryByte(uint8_t saddr,uint8_t maddr, uint8_t *data);
-void i2c1_readByte(uint8_t saddr, uint8_t *data);
-void i2c1_readMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length);
-void i2c1_writeMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length);
+/* Testa o bit do endereco addr no mapa de presenca de 128 bits preenchido por i2c_scan_fast() */
+#define I2C_BITMAP_TEST(map,addr)	(((map)[(addr)>>5]>>((addr)&31))&1U)
+
+/*
+ * Pinos dos barramentos. O I2C1 fica em PB6/PB7 ou, com I2C1_REMAP=1, em PB8/PB9 (AFIO_MAPR.I2C1_REMAP). O I2C2 nao
+ * tem remapeamento no F103: e sempre PB10/PB11. As duas opcoes sao conferidas em tempo de compilacao.
+ * */
+#ifndef I2C1_REMAP
+#define I2C1_REMAP		0
+#endif
+#ifndef I2C_USE_I2C2
+#define I2C_USE_I2C2	1
+#endif
+
+#if I2C1_REMAP!=0 && I2C1_REMAP!=1
+#error "I2C1_REMAP deve ser 0 (PB6/PB7) ou 1 (PB8/PB9)"
+#endif
+#if I2C_USE_I2C2 && !defined(I2C2)
+#error "Este dispositivo nao tem I2C2"
+#endif
+
+#define I2C1_SCL_PIN	(I2C1_REMAP?8:6)
+#define I2C2_SCL_PIN	10
+
+/*
+ * Mascara dos pinos do GPIOB ocupados pelo I2C. Cada modulo que usa um pino do GPIOB confere o seu contra
+ * I2C_PINS_USED com _Static_assert (ds3231.c, mpu6050.c). I2C1 (PB6-PB9) e I2C2 (PB10/PB11) nunca se sobrepoem.
+ * */
+#define I2C1_PINS		(3U<<I2C1_SCL_PIN)
+#define I2C2_PINS		(I2C_USE_I2C2?(3U<<I2C2_SCL_PIN):0U)
+#define I2C_PINS_USED	(I2C1_PINS|I2C2_PINS)
+
+/*
+ * Transferencias da fila com pelo menos I2C_DMA_MIN bytes de dados usam o DMA1: I2C1_TX = canal 6, I2C1_RX = canal 7,
+ * I2C2_TX = canal 4, I2C2_RX = canal 5.
+ * */
+#define I2C_DMA_MIN		8U
+
+#define I2C_SPEED_STANDARD	100000U
+#define I2C_SPEED_FAST		400000U
+
+/* Estado de uma transferencia da fila */
+#define I2C_XFER_QUEUED		0
+#define I2C_XFER_DONE		1
+#define I2C_XFER_ERROR		-1
+
+typedef struct i2c_xfer i2c_xfer_t;
+
+/*
+ * Transferencia assincrona: escreve nreg bytes de endereco de registrador (0, 1 ou 2, o mais significativo primeiro)
+ * e depois escreve (read=0) ou le com START repetido (read=1) length bytes em data. O buffer precisa continuar valido
+ * ate o status sair de I2C_XFER_QUEUED. done, se nao for NULL, e chamada dentro da interrupcao.
+ * */
+struct i2c_xfer
+{
+	uint8_t saddr;
+	uint8_t nreg;
+	uint16_t reg;
+	uint8_t read;
+	uint8_t *data;
+	uint16_t length;
+	void (*done)(i2c_xfer_t *xfer);
+	void *ctx;
+	volatile int8_t status;
+	i2c_xfer_t *next;
+};
+
+/* Um barramento: a parte constante descreve o hardware, o resto e a fila e a maquina de estados da interrupcao */
+typedef struct
+{
+	I2C_TypeDef *regs;
+	uint32_t rcc_en;		// bit em RCC_APB1ENR
+	uint8_t scl_pin;		// SDA e o pino seguinte do GPIOB
+	IRQn_Type ev_irq;
+	IRQn_Type er_irq;
+	DMA_Channel_TypeDef *dma_tx;
+	DMA_Channel_TypeDef *dma_rx;
+	IRQn_Type dma_rx_irq;
+	uint32_t dma_rx_ifcr;	// flags do canal de recepcao em DMA1->IFCR
+
+	i2c_xfer_t *volatile head;
+	i2c_xfer_t *tail;
+	uint8_t phase;
+	uint16_t index;
+	volatile uint32_t completed;
+	volatile uint32_t errors;
+} i2c_bus_t;
+
+extern i2c_bus_t i2c_bus1;
+#if I2C_USE_I2C2
+extern i2c_bus_t i2c_bus2;
+#endif
+
+void i2c_bus_init(i2c_bus_t *bus, uint32_t speed);
+void i2c_submit(i2c_bus_t *bus, i2c_xfer_t *xfer);
+int i2c_idle(const i2c_bus_t *bus);
+
+void i2c_scan_bus(i2c_bus_t *bus);
+int i2c_probe(i2c_bus_t *bus, uint8_t saddr);
+int i2c_scan_fast(i2c_bus_t *bus, uint32_t map[4], uint8_t skip_reserved);
+void i2c_MemoryWrite_Byte(i2c_bus_t *bus, uint8_t saddr,uint8_t maddr, uint8_t data);
+void i2c_Write_Byte(i2c_bus_t *bus, uint8_t saddr, uint8_t data);
+void i2c_readMemoryByte(i2c_bus_t *bus, uint8_t saddr,uint8_t maddr, uint8_t *data);
+void i2c_readByte(i2c_bus_t *bus, uint8_t saddr, uint8_t *data);
+void i2c_readMemoryMulti(i2c_bus_t *bus, uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length);
+void i2c_writeMemoryMulti(i2c_bus_t *bus, uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length);
+void i2c_readMemory16(i2c_bus_t *bus, uint8_t saddr, uint16_t maddr, uint8_t *data, uint16_t length);
+void i2c_writeMemory16(i2c_bus_t *bus, uint8_t saddr, uint16_t maddr, const uint8_t *data, uint8_t length);
+
+/* Interface antiga, fixa no I2C1, mantida para os drivers existentes */
+static inline void i2c_init(void) { i2c_bus_init(&i2c_bus1,I2C_SPEED_STANDARD); }
+static inline void i2c1_scan_bus(void) { i2c_scan_bus(&i2c_bus1); }
+static inline int i2c1_probe(uint8_t saddr) { return i2c_probe(&i2c_bus1,saddr); }
+static inline int i2c1_scan_fast(uint32_t map[4], uint8_t skip_reserved) { return i2c_scan_fast(&i2c_bus1,map,skip_reserved); }
+static inline void i2c1_MemoryWrite_Byte(uint8_t saddr,uint8_t maddr, uint8_t data) { i2c_MemoryWrite_Byte(&i2c_bus1,saddr,maddr,data); }
+static inline void i2c1_Write_Byte(uint8_t saddr, uint8_t data) { i2c_Write_Byte(&i2c_bus1,saddr,data); }
+static inline void i2c1_readMemoryByte(uint8_t saddr,uint8_t maddr, uint8_t *data) { i2c_readMemoryByte(&i2c_bus1,saddr,maddr,data); }
+static inline void i2c1_readByte(uint8_t saddr, uint8_t *data) { i2c_readByte(&i2c_bus1,saddr,data); }
+static inline void i2c1_readMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length) { i2c_readMemoryMulti(&i2c_bus1,saddr,maddr,data,length); }
+static inline void i2c1_writeMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length) { i2c_writeMemoryMulti(&i2c_bus1,saddr,maddr,data,length); }
+static inline void i2c1_readMemory16(uint8_t saddr, uint16_t maddr, uint8_t *data, uint16_t length) { i2c_readMemory16(&i2c_bus1,saddr,maddr,data,length); }
+static inline void i2c1_writeMemory16(uint8_t saddr, uint16_t maddr, const uint8_t *data, uint8_t length) { i2c_writeMemory16(&i2c_bus1,saddr,maddr,data,length); }
 
 #endif /* I2C_H_ */
@@ -0,0 +1,42 @@
+#ifndef I2C_SCHED_H_
+#define I2C_SCHED_H_
+
+#include "stdint.h"
+
+#define I2C_SCHED_MAX_JOBS		8		// quantidade maxima de planos de leitura registrados
+#define I2C_SCHED_MAX_BURST		32		// maior leitura agrupada (tamanho do buffer de rajada)
+#define I2C_SCHED_MERGE_GAP		4		// bytes "de sobra" aceitos para unir dois planos do mesmo dispositivo
+#define I2C_SCHED_HIST_BINS		16		// histograma log2 de latencia: 0 us ate >= 16 ms
+
+/*
+ * Plano de leitura de um dispositivo. O driver preenche os campos do plano (mesma semantica de
+ * i2c1_readMemoryMulti(): endereco do escravo, registrador inicial, quantidade de bytes e buffer de destino),
+ * o periodo em ms e a prioridade (0 = mais urgente). O resto e estado interno do escalonador.
+ * */
+typedef struct i2c_job i2c_job_t;
+struct i2c_job
+{
+	uint8_t saddr;
+	uint8_t reg;
+	uint8_t length;
+	uint8_t priority;
+	uint16_t period_ms;
+	uint8_t *data;
+	void (*done)(i2c_job_t *job);	// chamado depois que data foi atualizado (pode ser NULL)
+
+	uint32_t due;					// instante (ciclos) da proxima execucao
+	uint8_t age;					// vezes que o plano venceu mas ficou para depois
+	uint8_t pending;
+	uint32_t runs;
+	uint32_t overruns;				// execucoes atrasadas mais de um periodo inteiro
+	uint16_t hist[I2C_SCHED_HIST_BINS];
+};
+
+void i2c_sched_init(void);
+int i2c_sched_add(i2c_job_t *job);
+uint32_t i2c_sched_run(uint32_t budget_us);
+void i2c_sched_reset_stats(void);
+uint32_t i2c_sched_utilisation(void);
+uint32_t i2c_sched_latency(const i2c_job_t *job, uint8_t percent);
+
+#endif /* I2C_SCHED_H_ */
@@ -0,0 +1,74 @@
+#ifndef MEMPOOL_H_
+#define MEMPOOL_H_
+
+#include "stdint.h"
+#include "stddef.h"
+
+/*
+ * Pools de blocos de tamanho fixo, dimensionados em tempo de compilacao. Substituem o heap do newlib (o _sbrk de
+ * sysmem.c recusa qualquer pedido): alocar e liberar custam sempre o mesmo numero de instrucoes e nao ha
+ * fragmentacao.
+ *
+ * mempool_alloc()/mempool_free() nao protegem o pool e servem para pools usados so no laco principal.
+ * As variantes _isr desligam as interrupcoes (PRIMASK salvo e restaurado) durante as poucas instrucoes da operacao e
+ * podem ser chamadas de qualquer contexto, inclusive de ISRs de prioridades diferentes usando o mesmo pool.
+ * */
+
+/* Os blocos sao multiplos de 4 bytes e alinhados em palavra (o bloco livre guarda o ponteiro do proximo) */
+#define MEMPOOL_WORDS(size)		(((size)+3U)/4U)
+
+typedef struct mempool_block mempool_block_t;
+struct mempool_block
+{
+	mempool_block_t *next;
+};
+
+typedef struct
+{
+	const char *name;
+	uint32_t *storage;
+	uint16_t block_size;			// bytes
+	uint16_t count;
+	uint16_t fresh;					// blocos nunca usados: [fresh, count) ainda nao entraram na lista livre
+	mempool_block_t *free;
+	uint16_t used;
+	uint16_t peak;					// maior quantidade de blocos em uso ao mesmo tempo
+	uint32_t allocs;
+	uint32_t failures;				// pedidos recusados por falta de bloco
+} mempool_t;
+
+/*
+ * Define um pool de n blocos de size bytes. Nao precisa de inicializacao: a lista livre comeca vazia e os blocos
+ * ainda nao usados sao entregues em ordem a partir de fresh.
+ * */
+#define MEMPOOL_DEFINE(pool, size, n) \
+	static uint32_t pool##_storage[(n)*MEMPOOL_WORDS(size)]; \
+	mempool_t pool={#pool,pool##_storage,MEMPOOL_WORDS(size)*4U,(n),0,NULL,0,0,0,0}
+
+void *mempool_alloc(mempool_t *pool);
+void mempool_free(mempool_t *pool, void *block);
+void *mempool_alloc_isr(mempool_t *pool);
+void mempool_free_isr(mempool_t *pool, void *block);
+int mempool_owns(const mempool_t *pool, const void *block);
+void mempool_reset_stats(mempool_t *pool);
+
+/*
+ * Buffers de mensagem: tres classes de tamanho (MSG_POOL_*), o pedido vai para a menor classe que couber.
+ * msg_free() descobre a classe pelo endereco. Podem ser usados de qualquer contexto.
+ * */
+#define MSG_POOL_SMALL_SIZE		32U
+#define MSG_POOL_SMALL_COUNT	8U
+#define MSG_POOL_MEDIUM_SIZE	64U
+#define MSG_POOL_MEDIUM_COUNT	2U
+#define MSG_POOL_LARGE_SIZE		128U
+#define MSG_POOL_LARGE_COUNT	1U
+#define MSG_POOLS				3U
+
+void *msg_alloc(size_t size);
+void msg_free(void *msg);
+mempool_t *msg_pool(uint8_t index);
+
+/* Pedidos feitos ao _sbrk (sempre recusados): diferente de 0 indica algum malloc escondido */
+uint32_t sbrk_denied(void);
+
+#endif /* MEMPOOL_H_ */
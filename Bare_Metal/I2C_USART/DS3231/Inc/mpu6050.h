@@ -0,0 +1,45 @@
+#ifndef MPU6050_H_
+#define MPU6050_H_
+
+#include "stdint.h"
+#include "i2c.h"
+
+#define MPU6050_ADDR			0x68	// AD0 = 0; com AD0 = 1 o endereco e 0x69 (o mesmo do DS3231: ficam em barramentos diferentes)
+
+/* Registradores do MPU-6050 */
+#define MPU6050_REG_SMPLRT_DIV	0x19
+#define MPU6050_REG_CONFIG		0x1A
+#define MPU6050_REG_GYRO_CFG	0x1B
+#define MPU6050_REG_ACCEL_CFG	0x1C
+#define MPU6050_REG_FIFO_EN		0x23
+#define MPU6050_REG_INT_PIN_CFG	0x37
+#define MPU6050_REG_INT_ENABLE	0x38
+#define MPU6050_REG_USER_CTRL	0x6A
+#define MPU6050_REG_PWR_MGMT_1	0x6B
+#define MPU6050_REG_FIFO_COUNT	0x72
+#define MPU6050_REG_FIFO_R_W	0x74
+#define MPU6050_REG_WHO_AM_I	0x75
+
+/* Pino que recebe o INT (data ready, push-pull ativo em alto): PB1 -> EXTI1. O EXTI0 e do SQW do DS3231. */
+#define MPU6050_INT_PIN			1
+
+/* Quantidade de amostras novas que dispara a leitura do FIFO, e maximo lido de uma vez (12 bytes por amostra) */
+#define MPU6050_BATCH			10
+#define MPU6050_MAX_BATCH		32
+
+/* Fila de amostras decodificadas entre a interrupcao e o laco principal (potencia de 2) */
+#define MPU6050_RING			64
+
+typedef struct
+{
+	uint32_t timestamp;		// instante da amostra em ciclos de timebase_cycles()
+	int16_t accel[3];		// X, Y, Z em mg (faixa de +/- 8 g)
+	int16_t gyro[3];		// X, Y, Z em decimos de grau por segundo (faixa de +/- 2000 dps)
+} mpu6050_sample_t;
+
+int mpu6050_init(i2c_bus_t *bus, uint16_t rate_hz);
+int mpu6050_read(mpu6050_sample_t *sample);
+uint32_t mpu6050_batches(void);
+uint32_t mpu6050_dropped(void);
+
+#endif /* MPU6050_H_ */
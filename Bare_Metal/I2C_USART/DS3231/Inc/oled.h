@@ -0,0 +1,32 @@
+#ifndef OLED_H_
+#define OLED_H_
+
+#include "stdint.h"
+#include "i2c.h"
+
+#define OLED_ADDR		0x3C
+#define OLED_WIDTH		128
+#define OLED_HEIGHT		64
+#define OLED_PAGES		(OLED_HEIGHT/8)
+
+/* Controlador do modulo: o SH1106 tem 132 colunas de RAM e a imagem comeca na coluna 2 */
+#define OLED_SSD1306	0
+#define OLED_SH1106		1
+
+/* Largura de um caractere de oled_text(): 5 colunas de desenho + 1 de espaco */
+#define OLED_CHAR_W		6
+
+int oled_init(i2c_bus_t *bus, uint8_t controller);
+uint16_t oled_flush(void);
+int oled_busy(void);
+
+void oled_clear(void);
+void oled_pixel(uint8_t x, uint8_t y, uint8_t on);
+void oled_hline(uint8_t x0, uint8_t x1, uint8_t y, uint8_t on);
+void oled_vline(uint8_t x, uint8_t y0, uint8_t y1, uint8_t on);
+void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t on);
+void oled_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t on);
+void oled_fill_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t on);
+uint8_t oled_text(uint8_t x, uint8_t page, const char *str);
+
+#endif /* OLED_H_ */
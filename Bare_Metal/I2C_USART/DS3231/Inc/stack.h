@@ -0,0 +1,34 @@
+#ifndef STACK_H_
+#define STACK_H_
+
+#include "stdint.h"
+
+/*
+ * Medida da pilha em tempo de execucao. Os arquivos .su do compilador dao o quadro de cada funcao, mas nao a
+ * profundidade real (cadeia de chamadas + interrupcoes aninhadas). Aqui a RAM livre e pintada com STACK_PAINT no
+ * startup e o ponto mais fundo alcancado e o primeiro word que perdeu a pintura, procurado de baixo para cima.
+ *
+ * A medida e um limite inferior: um buffer local reservado mas nunca escrito nao apaga a pintura.
+ * */
+
+#define STACK_PAINT			0xDEADBEEFUL	// o mesmo valor esta no Reset_Handler (startup_stm32f103c8tx.s)
+#define STACK_MAX_REGIONS	4U				// pilha principal + pilhas de tarefas
+
+typedef struct
+{
+	const char *name;
+	uint32_t *bottom;			// menor endereco pintado
+	uint32_t *limit;			// fundo da reserva: usar abaixo disso e estourar a reserva
+	uint32_t *top;				// um depois do maior endereco (a pilha desce a partir daqui)
+	uint32_t peak;				// bytes no ponto mais fundo encontrado ate agora
+} stack_region_t;
+
+void stack_init(void);
+int stack_register(const char *name, void *base, uint32_t size);
+uint32_t stack_high_water(uint8_t index);
+int stack_overflowed(uint8_t index);
+uint8_t stack_count(void);
+const stack_region_t *stack_region(uint8_t index);
+void stack_report(void);
+
+#endif /* STACK_H_ */
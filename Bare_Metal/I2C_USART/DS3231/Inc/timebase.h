@@ -0,0 +1,34 @@
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+#include "stdint.h"
+#include "stm32f1xx.h"
+
+/* Clock do nucleo (HSI de 8 MHz, sem PLL). Deve acompanhar o CPU_CLK usado em uart.c */
+#define TIMEBASE_CPU_HZ			8000000UL
+#define TIMEBASE_CYCLES_PER_US	(TIMEBASE_CPU_HZ/1000000UL)
+#define TIMEBASE_CYCLES_PER_MS	(TIMEBASE_CPU_HZ/1000UL)
+
+void timebase_init(void);
+
+/*
+ * Contador de ciclos do nucleo (DWT->CYCCNT). A 8 MHz ele da a volta a cada ~536 s, entao intervalos devem ser
+ * calculados sempre por subtracao (now - start), que continua correta mesmo depois do estouro.
+ * */
+static inline uint32_t timebase_cycles(void)
+{
+	return DWT->CYCCNT;
+}
+
+static inline uint32_t timebase_us(void)
+{
+	return DWT->CYCCNT/TIMEBASE_CYCLES_PER_US;
+}
+
+/* Diferenca com sinal entre dois instantes em ciclos: > 0 quando a esta depois de b */
+static inline int32_t timebase_diff(uint32_t a, uint32_t b)
+{
+	return (int32_t)(a-b);
+}
+
+#endif /* TIMEBASE_H_ */
@@ -0,0 +1,34 @@
+#ifndef TIMECONV_H_
+#define TIMECONV_H_
+
+#include "stdint.h"
+#include "ds3231.h"
+
+/* Tamanho do texto gerado por time_format_iso8601(): "AAAA-MM-DDTHH:MM:SSZ" + '\0' */
+#define TIME_ISO8601_LEN	21
+
+/*
+ * BCD <-> binario de um byte (0-99). A divisao por 10 vira multiplicacao e deslocamento: (x*205)>>11 e exato
+ * para x < 1029, entao nao ha divisao nem desvio.
+ * */
+static inline uint8_t bcd_to_bin(uint8_t x)
+{
+	return x-6*(x>>4);
+}
+
+static inline uint8_t bin_to_bcd(uint8_t x)
+{
+	return x+6*((x*205U)>>11);
+}
+
+void bcd_unpack_block(uint8_t *dst, const uint8_t *src, uint32_t n);
+void bcd_pack_block(uint8_t *dst, const uint8_t *src, uint32_t n);
+
+int32_t days_from_civil(uint32_t year, uint32_t month, uint32_t day);
+void civil_from_days(int32_t days, uint16_t *year, uint8_t *month, uint8_t *day);
+
+uint64_t time_to_epoch(const ds3231_time_t *time);
+void epoch_to_time(uint64_t epoch, ds3231_time_t *time);
+uint8_t time_format_iso8601(char *buf, const ds3231_time_t *time);
+
+#endif /* TIMECONV_H_ */
@@ -0,0 +1,73 @@
+#include "at24c32.h"
+#include "i2c.h"
+
+/*
+ * Driver da EEPROM AT24C32 (4 KB, paginas de 32 bytes, endereco interno de 16 bits).
+ *
+ * Depois de cada escrita de pagina a EEPROM fica ate 10 ms gravando e, nesse tempo, nao responde ao proprio endereco
+ * (NACK). Em vez de esperar um tempo fixo, o driver testa o endereco (ACK polling, i2c1_probe()) e continua assim que
+ * ela responde, o que normalmente acontece bem antes do pior caso. O teste e feito no inicio de cada operacao, e nao
+ * no fim da escrita: a ultima pagina grava enquanto o programa faz outras coisas.
+ * */
+
+/* Espera a EEPROM terminar a gravacao anterior. Retorna 0 quando pronta ou -1 em timeout/erro de barramento. */
+int at24c32_wait_ready(void)
+{
+	for(uint32_t i=0;i<AT24C32_POLL_MAX;i++)
+	{
+		int r=i2c1_probe(AT24C32_ADDR);
+		if(r<0)
+		{
+			return -1;
+		}
+		if(r)
+		{
+			return 0;
+		}
+	}
+	return -1;
+}
+
+/* Leitura sequencial de qualquer tamanho: o contador interno da EEPROM avanca sozinho, sem limite de pagina */
+int at24c32_read(uint16_t addr, uint8_t *data, uint16_t length)
+{
+	if(length==0)
+	{
+		return 0;
+	}
+	if((uint32_t)addr+length>AT24C32_SIZE || at24c32_wait_ready()<0)
+	{
+		return -1;
+	}
+	i2c1_readMemory16(AT24C32_ADDR,addr,data,length);
+	return 0;
+}
+
+/*
+ * Escreve length bytes a partir de addr. A escrita e dividida nos limites de pagina de 32 bytes: dentro de uma pagina
+ * o contador de endereco da EEPROM da a volta, entao um bloco que atravessa o limite sobrescreveria o inicio da pagina.
+ * */
+int at24c32_write(uint16_t addr, const uint8_t *data, uint16_t length)
+{
+	if((uint32_t)addr+length>AT24C32_SIZE)
+	{
+		return -1;
+	}
+	while(length>0)
+	{
+		uint16_t chunk=AT24C32_PAGE-(addr&(AT24C32_PAGE-1));
+		if(chunk>length)
+		{
+			chunk=length;
+		}
+		if(at24c32_wait_ready()<0)
+		{
+			return -1;
+		}
+		i2c1_writeMemory16(AT24C32_ADDR,addr,data,(uint8_t)chunk);
+		addr+=chunk;
+		data+=chunk;
+		length-=chunk;
+	}
+	return 0;
+}
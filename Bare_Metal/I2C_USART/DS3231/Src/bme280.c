@@ -0,0 +1,171 @@
+#include "bme280.h"
+#include "i2c.h"
+#include "i2c_sched.h"
+#include "timebase.h"
+
+/*
+ * Sensor de pressao, temperatura e umidade BME280 no I2C1.
+ *
+ * A calibracao (33 bytes em dois blocos) e lida uma unica vez na inicializacao e guardada ja decodificada. O sensor
+ * fica em modo forcado: cada conversao e pedida com uma escrita em CTRL_MEAS e o sensor volta a dormir sozinho, o
+ * que gasta bem menos que o modo normal quando a taxa e baixa. A leitura e um plano do escalonador (i2c_sched) com o
+ * periodo pedido: os 8 bytes de 0xF7 a 0xFE saem numa unica rajada e a callback compensa os valores e ja dispara a
+ * conversao seguinte, que fica pronta antes do proximo vencimento.
+ *
+ * A compensacao e a versao inteira do datasheet (secao 4.2.3): temperatura e umidade em 32 bits e pressao em 64
+ * bits. No Cortex-M3 sem FPU a versao em float custa milhares de ciclos por amostra em rotinas de software; a
+ * inteira custa poucas centenas (a maior parte na divisao de 64 bits da pressao).
+ * */
+
+/* CTRL_HUM: umidade x1. CTRL_MEAS: temperatura x1, pressao x1, modo forcado. CONFIG: sem filtro IIR. */
+#define CTRL_HUM_OSRS_H1		0x01
+#define CTRL_MEAS_FORCED_X1		((1U<<5)|(1U<<2)|0x01)
+
+static bme280_calib_t calib;
+static uint8_t raw[BME280_DATA_LEN];
+static bme280_data_t latest;
+static volatile uint8_t fresh;
+static i2c_job_t job;
+
+static uint16_t le16(const uint8_t *p)
+{
+	return (uint16_t)(p[0]|(p[1]<<8));
+}
+
+/* Decodifica os dois blocos de calibracao (0x88-0xA1 e 0xE1-0xE7) */
+static void bme280_parse_calib(const uint8_t *c0, const uint8_t *c1)
+{
+	calib.dig_T1=le16(&c0[0]);
+	calib.dig_T2=(int16_t)le16(&c0[2]);
+	calib.dig_T3=(int16_t)le16(&c0[4]);
+	calib.dig_P1=le16(&c0[6]);
+	calib.dig_P2=(int16_t)le16(&c0[8]);
+	calib.dig_P3=(int16_t)le16(&c0[10]);
+	calib.dig_P4=(int16_t)le16(&c0[12]);
+	calib.dig_P5=(int16_t)le16(&c0[14]);
+	calib.dig_P6=(int16_t)le16(&c0[16]);
+	calib.dig_P7=(int16_t)le16(&c0[18]);
+	calib.dig_P8=(int16_t)le16(&c0[20]);
+	calib.dig_P9=(int16_t)le16(&c0[22]);
+	calib.dig_H1=c0[25];
+	calib.dig_H2=(int16_t)le16(&c1[0]);
+	calib.dig_H3=c1[2];
+	// H4 e H5 tem 12 bits e dividem o registrador 0xE5
+	calib.dig_H4=(int16_t)(((int8_t)c1[3]*16)|(c1[4]&0x0F));
+	calib.dig_H5=(int16_t)(((int8_t)c1[5]*16)|(c1[4]>>4));
+	calib.dig_H6=(int8_t)c1[6];
+}
+
+/* Compensa uma leitura bruta de 8 bytes (0xF7-0xFE) com as formulas inteiras do datasheet */
+void bme280_compensate(const bme280_calib_t *cal, const uint8_t r[BME280_DATA_LEN], bme280_data_t *data)
+{
+	int32_t adc_P=(int32_t)((r[0]<<12)|(r[1]<<4)|(r[2]>>4));
+	int32_t adc_T=(int32_t)((r[3]<<12)|(r[4]<<4)|(r[5]>>4));
+	int32_t adc_H=(int32_t)((r[6]<<8)|r[7]);
+
+	/* Temperatura: t_fine tambem entra na pressao e na umidade */
+	int32_t v1=((((adc_T>>3)-((int32_t)cal->dig_T1<<1)))*((int32_t)cal->dig_T2))>>11;
+	int32_t v2=(((((adc_T>>4)-((int32_t)cal->dig_T1))*((adc_T>>4)-((int32_t)cal->dig_T1)))>>12)*
+			((int32_t)cal->dig_T3))>>14;
+	int32_t t_fine=v1+v2;
+	data->temperature=(t_fine*5+128)>>8;
+
+	/* Pressao em 64 bits */
+	int64_t p1=((int64_t)t_fine)-128000;
+	int64_t p2=p1*p1*(int64_t)cal->dig_P6;
+	p2=p2+((p1*(int64_t)cal->dig_P5)<<17);
+	p2=p2+(((int64_t)cal->dig_P4)<<35);
+	p1=((p1*p1*(int64_t)cal->dig_P3)>>8)+((p1*(int64_t)cal->dig_P2)<<12);
+	p1=(((((int64_t)1)<<47)+p1))*((int64_t)cal->dig_P1)>>33;
+	if(p1==0)
+	{
+		data->pressure=0;			// evita divisao por zero (calibracao invalida)
+	}
+	else
+	{
+		int64_t p=1048576-adc_P;
+		p=(((p<<31)-p2)*3125)/p1;
+		p1=(((int64_t)cal->dig_P9)*(p>>13)*(p>>13))>>25;
+		p2=(((int64_t)cal->dig_P8)*p)>>19;
+		p=((p+p1+p2)>>8)+(((int64_t)cal->dig_P7)<<4);
+		data->pressure=(uint32_t)p;
+	}
+
+	/* Umidade em 32 bits */
+	int32_t h=t_fine-((int32_t)76800);
+	h=(((((adc_H<<14)-(((int32_t)cal->dig_H4)<<20)-(((int32_t)cal->dig_H5)*h))+((int32_t)16384))>>15)*
+			(((((((h*((int32_t)cal->dig_H6))>>10)*(((h*((int32_t)cal->dig_H3))>>11)+((int32_t)32768)))>>10)+
+			((int32_t)2097152))*((int32_t)cal->dig_H2)+8192)>>14));
+	h=(h-(((((h>>15)*(h>>15))>>7)*((int32_t)cal->dig_H1))>>4));
+	h=(h<0)?0:h;
+	h=(h>419430400)?419430400:h;
+	data->humidity=(uint32_t)(h>>12);
+}
+
+/* Callback do escalonador: os 8 bytes de medida acabaram de chegar */
+static void bme280_done(i2c_job_t *j)
+{
+	bme280_compensate(&calib,raw,&latest);
+	latest.timestamp=timebase_cycles();
+	fresh=1;
+	// Proxima conversao; termina em < 10 ms, antes do proximo vencimento
+	i2c1_MemoryWrite_Byte(j->saddr,BME280_REG_CTRL_MEAS,CTRL_MEAS_FORCED_X1);
+}
+
+/*
+ * Confere o chip, le a calibracao, dispara a primeira conversao e registra a leitura periodica (period_ms, no minimo
+ * BME280_MIN_PERIOD_MS) no escalonador. Requer i2c_init() e i2c_sched_init(). Retorna -1 se o sensor nao responder
+ * ou se a tabela do escalonador estiver cheia.
+ * */
+int bme280_init(uint8_t saddr, uint16_t period_ms)
+{
+	uint8_t id=0;
+	uint8_t c0[26];
+	uint8_t c1[7];
+
+	if(i2c1_probe(saddr)!=1)
+	{
+		return -1;
+	}
+	i2c1_readMemoryByte(saddr,BME280_REG_CHIP_ID,&id);
+	if(id!=BME280_CHIP_ID)
+	{
+		return -1;
+	}
+	i2c1_readMemoryMulti(saddr,BME280_REG_CALIB00,c0,sizeof(c0));
+	i2c1_readMemoryMulti(saddr,BME280_REG_CALIB26,c1,sizeof(c1));
+	bme280_parse_calib(c0,c1);
+
+	// CTRL_HUM so tem efeito depois de uma escrita em CTRL_MEAS
+	i2c1_MemoryWrite_Byte(saddr,BME280_REG_CTRL_HUM,CTRL_HUM_OSRS_H1);
+	i2c1_MemoryWrite_Byte(saddr,BME280_REG_CONFIG,0x00);
+	i2c1_MemoryWrite_Byte(saddr,BME280_REG_CTRL_MEAS,CTRL_MEAS_FORCED_X1);
+
+	fresh=0;
+	job.saddr=saddr;
+	job.reg=BME280_REG_DATA;
+	job.length=BME280_DATA_LEN;
+	job.priority=2;
+	job.period_ms=(period_ms<BME280_MIN_PERIOD_MS)?BME280_MIN_PERIOD_MS:period_ms;
+	job.data=raw;
+	job.done=bme280_done;
+	if(i2c_sched_add(&job)<0)
+	{
+		return -1;
+	}
+	// A primeira leitura so pode vir depois da primeira conversao
+	job.due+=BME280_MIN_PERIOD_MS*TIMEBASE_CYCLES_PER_MS;
+	return 0;
+}
+
+/* Copia a ultima medida compensada. Retorna 1 se ela e nova desde a chamada anterior, 0 caso contrario. */
+int bme280_get(bme280_data_t *data)
+{
+	*data=latest;
+	if(!fresh)
+	{
+		return 0;
+	}
+	fresh=0;
+	return 1;
+}
@@ -0,0 +1,478 @@
+#include "ds3231.h"
+#include "i2c.h"
+#include "timebase.h"
+#include "timeconv.h"
+#include "stm32f1xx.h"
+
+/*
+ * Relogio de software sincronizado pela saida de 1 Hz do DS3231.
+ *
+ * O DS3231 atualiza os registradores de tempo na borda de descida da saida SQW (ela sobe 500 ms depois). Em vez de
+ * ler os registradores pelo I2C toda vez que alguem precisa da hora, o pino SQW gera uma interrupcao EXTI a cada
+ * segundo; a rotina de interrupcao apenas incrementa os segundos (com vai-um para minutos e horas) e guarda o
+ * instante da borda no contador de ciclos. A fracao do segundo atual e interpolada com esse contador.
+ *
+ * A leitura completa dos 7 registradores de data/hora so acontece quando necessario:
+ *  - na inicializacao;
+ *  - quando o intervalo entre bordas sai da faixa esperada (borda perdida ou ruido no pino);
+ *  - na virada do dia (dia do mes/mes/ano dependem do calendario, que fica por conta do chip);
+ *  - a cada DS3231_RESYNC_S segundos, para conferir a deriva.
+ *
+ * O pino SQW/INT e compartilhado: quando os alarmes sao programados com saida de interrupcao (INTCN = 1) a onda de
+ * 1 Hz para e a mesma linha EXTI passa a sinalizar alarmes. Nesse modo o relogio de software e relido do chip uma
+ * vez por segundo em ds3231_service().
+ *
+ * Os demais registradores ficam numa copia local (regs[]), atualizada por ds3231_snapshot() e pelas escritas, para
+ * que alarmes, controle, status e envelhecimento (aging) sejam gravados no menor numero possivel de transacoes:
+ * os registradores 0x07 a 0x10 sao consecutivos, entao alarmes + controle + status cabem em uma unica escrita.
+ * */
+
+_Static_assert(!(I2C_PINS_USED&(1U<<DS3231_SQW_PIN)),"DS3231_SQW_PIN ocupado por um barramento I2C");
+
+/* Intervalo aceito entre duas bordas: 1 s +/- 10% */
+#define SQW_MIN_CYCLES	(TIMEBASE_CPU_HZ-TIMEBASE_CPU_HZ/10U)
+#define SQW_MAX_CYCLES	(TIMEBASE_CPU_HZ+TIMEBASE_CPU_HZ/10U)
+
+static volatile ds3231_time_t sw_time;
+static volatile uint32_t edge_cycles;		// instante (DWT) da ultima borda de descida
+static volatile uint32_t edge_count;		// bordas desde a ultima sincronizacao
+static volatile uint32_t seq;				// impar enquanto sw_time esta sendo alterado
+static volatile uint8_t resync;
+static volatile uint8_t sqw_mode;			// 1: SQW em 1 Hz, 0: SQW/INT sinaliza alarmes
+static volatile uint8_t alarm_pending;
+static uint32_t resyncs;
+static uint8_t regs[DS3231_NUM_REGS];		// ultima copia conhecida dos registradores do chip
+static void (*alarm_callback)(uint8_t flags);
+
+/* Converte os 7 registradores de data/hora (BCD): os bits de controle sao mascarados e o bloco e convertido de uma vez */
+static void ds3231_decode_time(const uint8_t *raw, ds3231_time_t *t)
+{
+	uint8_t v[7];
+
+	v[0]=raw[0]&0x7F;
+	v[1]=raw[1]&0x7F;
+	v[2]=raw[2]&((raw[2]&0x40)?0x1F:0x3F);
+	v[3]=raw[3]&0x07;
+	v[4]=raw[4]&0x3F;
+	v[5]=raw[5]&0x1F;
+	v[6]=raw[6];
+	bcd_unpack_block(v,v,7);
+
+	t->seconds=v[0];
+	t->minutes=v[1];
+	// Modo 12 h: bit 6 = 12 h, bit 5 = PM
+	t->hours=(raw[2]&0x40)?(v[2]%12+((raw[2]&0x20)?12:0)):v[2];
+	t->day=v[3];
+	t->date=v[4];
+	t->month=v[5];
+	t->year=2000+v[6]+((raw[5]&0x80)?100:0);
+}
+
+static void ds3231_encode_time(const ds3231_time_t *t, uint8_t *raw)
+{
+	raw[0]=t->seconds;
+	raw[1]=t->minutes;
+	raw[2]=t->hours;						// modo 24 h
+	raw[3]=t->day;
+	raw[4]=t->date;
+	raw[5]=t->month;
+	raw[6]=t->year%100;
+	bcd_pack_block(raw,raw,7);
+	raw[5]|=(t->year>=2100)?0x80:0;
+}
+
+/* Le os 7 registradores de data/hora em uma unica transacao */
+static void ds3231_read_time(ds3231_time_t *t)
+{
+	i2c1_readMemoryMulti(DS3231_ADDR,DS3231_REG_SECONDS,regs,7);
+	ds3231_decode_time(regs,t);
+}
+
+/*
+ * Alarmes: o bit 7 de cada registrador (AxMy) indica "nao comparar este campo" e o bit 6 do registrador de dia
+ * escolhe dia da semana (1) ou dia do mes (0). A quantidade de campos comparados, do segundo para o dia, define o
+ * modo. fields = 4 para o alarme 1 (segundos, minutos, horas, dia) e 3 para o alarme 2 (sem segundos).
+ * */
+static void ds3231_encode_alarm(const ds3231_alarm_t *a, uint8_t *raw, uint8_t fields)
+{
+	uint8_t value[4]={bin_to_bcd(a->seconds),bin_to_bcd(a->minutes),bin_to_bcd(a->hours),bin_to_bcd(a->day_date)};
+	uint8_t matched=(a->mode==DS3231_ALARM_OFF)?0:(uint8_t)(a->mode-DS3231_ALARM_EVERY);
+	uint8_t first=4-fields;
+
+	if(a->mode==DS3231_ALARM_MATCH_DAY)
+	{
+		value[3]=(a->day_date&0x07)|0x40;
+		matched=4;
+	}
+	for(uint8_t i=first;i<4;i++)
+	{
+		raw[i-first]=value[i]|((i>=matched)?0x80:0);
+	}
+}
+
+static void ds3231_decode_alarm(const uint8_t *raw, ds3231_alarm_t *a, uint8_t fields, uint8_t enabled)
+{
+	uint8_t first=4-fields;
+	uint8_t matched=0;
+
+	a->seconds=fields==4?bcd_to_bin(raw[0]&0x7F):0;
+	a->minutes=bcd_to_bin(raw[1-first]&0x7F);
+	a->hours=bcd_to_bin(raw[2-first]&0x3F);
+	a->day_date=(raw[3-first]&0x40)?(raw[3-first]&0x07):bcd_to_bin(raw[3-first]&0x3F);
+
+	while(matched<4 && (matched<first || !(raw[matched-first]&0x80)))
+	{
+		matched++;
+	}
+	if(fields==3 && matched==1)
+	{
+		matched=0;					// alarme 2 sem nenhum campo comparado: todo minuto
+	}
+	if(!enabled)
+	{
+		a->mode=DS3231_ALARM_OFF;
+	}
+	else if(matched==4)
+	{
+		a->mode=(raw[3-first]&0x40)?DS3231_ALARM_MATCH_DAY:DS3231_ALARM_MATCH_DATE;
+	}
+	else
+	{
+		a->mode=(ds3231_alarm_mode_t)(DS3231_ALARM_EVERY+matched);
+	}
+}
+
+/* Valor de status que, escrito de volta, nao apaga nenhuma flag (A1F, A2F e OSF so aceitam escrita de 0) */
+static uint8_t ds3231_status_keep(void)
+{
+	return regs[DS3231_REG_STATUS]|DS3231_STAT_A1F|DS3231_STAT_A2F;
+}
+
+/*
+ * Le o chip e substitui o relogio de software. Se uma borda chegar durante a leitura, o valor lido pode ja estar
+ * velho, entao a leitura e repetida ate nao haver borda no meio.
+ * */
+static void ds3231_resync(void)
+{
+	ds3231_time_t t;
+	uint32_t before;
+
+	for(;;)
+	{
+		before=seq;
+		ds3231_read_time(&t);
+
+		__disable_irq();
+		if(before==seq)
+		{
+			seq++;
+			sw_time=t;
+			edge_count=0;
+			resync=0;
+			if(!sqw_mode)
+			{
+				// Sem bordas de 1 Hz: a fracao do segundo passa a ser contada a partir da leitura
+				edge_cycles=timebase_cycles();
+			}
+			seq++;
+			__enable_irq();
+			break;
+		}
+		__enable_irq();
+	}
+	resyncs++;
+}
+
+/* Configura PB0 como entrada com pull-up e liga a borda de descida ao EXTI0 */
+static void ds3231_sqw_exti_init(void)
+{
+	RCC->APB2ENR|=RCC_APB2ENR_IOPBEN|RCC_APB2ENR_AFIOEN;
+
+	GPIOB->CRL&=~(GPIO_CRL_MODE0|GPIO_CRL_CNF0);
+	GPIOB->CRL|=GPIO_CRL_CNF0_1;			// CNF0 = 10: entrada com pull-up/pull-down
+	GPIOB->BSRR=(1U<<DS3231_SQW_PIN);		// ODR = 1 -> pull-up
+
+	AFIO->EXTICR[0]&=~AFIO_EXTICR1_EXTI0;
+	AFIO->EXTICR[0]|=AFIO_EXTICR1_EXTI0_PB;
+	EXTI->FTSR|=EXTI_FTSR_FT0;
+	EXTI->RTSR&=~EXTI_RTSR_RT0;
+	EXTI->PR=EXTI_PR_PR0;
+	EXTI->IMR|=EXTI_IMR_MR0;
+
+	NVIC_SetPriority(EXTI0_IRQn,1);
+	NVIC_EnableIRQ(EXTI0_IRQn);
+}
+
+/*
+ * Programa a saida SQW/INT para onda quadrada de 1 Hz (INTCN = 0, RS2:RS1 = 00), le a hora atual e habilita a
+ * interrupcao. Requer i2c_init() e timebase_init() antes. Retorna -1 se o DS3231 nao responder.
+ * */
+int ds3231_init(void)
+{
+	ds3231_snapshot_t snap;
+
+	if(i2c1_probe(DS3231_ADDR)!=1)
+	{
+		return -1;
+	}
+
+	ds3231_snapshot(&snap);
+	regs[DS3231_REG_CONTROL]&=~(DS3231_CTRL_INTCN|DS3231_CTRL_RS1|DS3231_CTRL_RS2|DS3231_CTRL_EOSC|DS3231_CTRL_CONV);
+	i2c1_MemoryWrite_Byte(DS3231_ADDR,DS3231_REG_CONTROL,regs[DS3231_REG_CONTROL]);
+	sqw_mode=1;
+
+	seq++;
+	sw_time=snap.time;
+	seq++;
+	edge_cycles=timebase_cycles();
+	ds3231_sqw_exti_init();
+	return 0;
+}
+
+/* Deve ser chamada no laco principal: faz a releitura pelo I2C quando a rotina de interrupcao pediu */
+void ds3231_service(void)
+{
+	if(!sqw_mode && (timebase_cycles()-edge_cycles)>=TIMEBASE_CPU_HZ)
+	{
+		resync=1;
+	}
+	if(resync)
+	{
+		ds3231_resync();
+	}
+	if(alarm_pending)
+	{
+		alarm_pending=0;
+		i2c1_readMemoryByte(DS3231_ADDR,DS3231_REG_STATUS,&regs[DS3231_REG_STATUS]);
+		uint8_t flags=regs[DS3231_REG_STATUS]&(DS3231_STAT_A1F|DS3231_STAT_A2F);
+		if(flags)
+		{
+			// Apaga apenas as flags que serao tratadas; isso tambem solta o pino INT
+			regs[DS3231_REG_STATUS]&=~flags;
+			i2c1_MemoryWrite_Byte(DS3231_ADDR,DS3231_REG_STATUS,regs[DS3231_REG_STATUS]);
+			if(alarm_callback)
+			{
+				alarm_callback(flags);
+			}
+		}
+	}
+}
+
+/*
+ * Copia a hora atual e, se us nao for NULL, os microssegundos decorridos desde o inicio do segundo. Nao usa o I2C:
+ * custa apenas a copia da estrutura. O contador seq (impar durante a escrita) garante uma copia consistente mesmo
+ * que a borda de 1 Hz chegue no meio.
+ * */
+void ds3231_now(ds3231_time_t *time, uint32_t *us)
+{
+	uint32_t s;
+	uint32_t edge;
+
+	do
+	{
+		s=seq;
+		__DMB();
+		// Campo a campo pelo acesso volatile: a copia fica entre as duas leituras de seq
+		time->seconds=sw_time.seconds;
+		time->minutes=sw_time.minutes;
+		time->hours=sw_time.hours;
+		time->day=sw_time.day;
+		time->date=sw_time.date;
+		time->month=sw_time.month;
+		time->year=sw_time.year;
+		edge=edge_cycles;
+		__DMB();
+	} while((s&1U) || s!=seq);
+
+	if(us)
+	{
+		uint32_t elapsed=(timebase_cycles()-edge)/TIMEBASE_CYCLES_PER_US;
+		*us=elapsed>999999U?999999U:elapsed;
+	}
+}
+
+uint32_t ds3231_resync_count(void)
+{
+	return resyncs;
+}
+
+/*
+ * Le os 19 registradores (0x00 a 0x12) em uma unica rajada e decodifica hora, alarmes, controle, status,
+ * envelhecimento e temperatura. Tambem atualiza a copia local usada pelas escritas.
+ * */
+void ds3231_snapshot(ds3231_snapshot_t *snap)
+{
+	i2c1_readMemoryMulti(DS3231_ADDR,DS3231_REG_SECONDS,snap->raw,DS3231_NUM_REGS);
+	for(uint8_t i=0;i<DS3231_NUM_REGS;i++)
+	{
+		regs[i]=snap->raw[i];
+	}
+
+	ds3231_decode_time(snap->raw,&snap->time);
+	snap->control=snap->raw[DS3231_REG_CONTROL];
+	snap->status=snap->raw[DS3231_REG_STATUS];
+	ds3231_decode_alarm(&snap->raw[DS3231_REG_ALARM1],&snap->alarm1,4,snap->control&DS3231_CTRL_A1IE);
+	ds3231_decode_alarm(&snap->raw[DS3231_REG_ALARM2],&snap->alarm2,3,snap->control&DS3231_CTRL_A2IE);
+	snap->aging=(int8_t)snap->raw[DS3231_REG_AGING];
+	snap->temperature=(int16_t)(((int8_t)snap->raw[DS3231_REG_TEMP_MSB]*4+(snap->raw[DS3231_REG_TEMP_LSB]>>6))*25);
+}
+
+/*
+ * Grava data e hora em uma unica escrita de 7 bytes. Escrever os segundos reinicia a contagem interna do chip, entao
+ * a proxima borda de 1 Hz vem 1 s depois desta escrita; o relogio de software e ajustado junto.
+ * */
+void ds3231_set_time(const ds3231_time_t *time)
+{
+	ds3231_encode_time(time,regs);
+	i2c1_writeMemoryMulti(DS3231_ADDR,DS3231_REG_SECONDS,regs,7);
+
+	__disable_irq();
+	seq++;
+	sw_time=*time;
+	edge_cycles=timebase_cycles();
+	edge_count=0;
+	resync=0;
+	seq++;
+	__enable_irq();
+}
+
+/*
+ * Programa os alarmes. Um ponteiro NULL mantem o alarme como esta. Com int_output diferente de 0 o pino SQW/INT passa
+ * a ser a saida de interrupcao dos alarmes (INTCN = 1) e a onda de 1 Hz para; com 0 os alarmes so levantam as flags
+ * A1F/A2F e o pino continua em 1 Hz. Alarmes, controle e status (flags de alarme apagadas) vao numa unica escrita.
+ * */
+void ds3231_set_alarms(const ds3231_alarm_t *alarm1, const ds3231_alarm_t *alarm2, uint8_t int_output)
+{
+	uint8_t start=alarm1?DS3231_REG_ALARM1:(alarm2?DS3231_REG_ALARM2:DS3231_REG_CONTROL);
+	uint8_t ctrl=regs[DS3231_REG_CONTROL]&~(DS3231_CTRL_INTCN|DS3231_CTRL_RS1|DS3231_CTRL_RS2|DS3231_CTRL_CONV);
+
+	if(alarm1)
+	{
+		ds3231_encode_alarm(alarm1,&regs[DS3231_REG_ALARM1],4);
+		ctrl=(alarm1->mode==DS3231_ALARM_OFF)?(ctrl&~DS3231_CTRL_A1IE):(ctrl|DS3231_CTRL_A1IE);
+	}
+	if(alarm2)
+	{
+		ds3231_encode_alarm(alarm2,&regs[DS3231_REG_ALARM2],3);
+		ctrl=(alarm2->mode==DS3231_ALARM_OFF)?(ctrl&~DS3231_CTRL_A2IE):(ctrl|DS3231_CTRL_A2IE);
+	}
+	if(int_output)
+	{
+		ctrl|=DS3231_CTRL_INTCN;
+	}
+	regs[DS3231_REG_CONTROL]=ctrl;
+	// Apaga as flags de alarme; OSF em 1 nao muda nada no chip e evita apagar um OSF que a copia ainda nao viu
+	regs[DS3231_REG_STATUS]=(regs[DS3231_REG_STATUS]|DS3231_STAT_OSF)&~(DS3231_STAT_A1F|DS3231_STAT_A2F);
+
+	i2c1_writeMemoryMulti(DS3231_ADDR,start,&regs[start],DS3231_REG_STATUS-start+1);
+
+	__disable_irq();
+	if(sqw_mode!=!int_output)
+	{
+		sqw_mode=!int_output;
+		resync=1;
+	}
+	alarm_pending=0;
+	__enable_irq();
+}
+
+/* Funcao chamada por ds3231_service() com as flags (DS3231_STAT_A1F/A2F) dos alarmes que dispararam */
+void ds3231_set_alarm_callback(void (*callback)(uint8_t flags))
+{
+	alarm_callback=callback;
+}
+
+/* Temperatura em centesimos de grau Celsius, lida dos 2 registradores de temperatura em uma rajada */
+int16_t ds3231_temperature(void)
+{
+	i2c1_readMemoryMulti(DS3231_ADDR,DS3231_REG_TEMP_MSB,&regs[DS3231_REG_TEMP_MSB],2);
+	return (int16_t)(((int8_t)regs[DS3231_REG_TEMP_MSB]*4+(regs[DS3231_REG_TEMP_LSB]>>6))*25);
+}
+
+/*
+ * Forca uma conversao de temperatura (e a atualizacao da compensacao do cristal). Controle e status sao lidos juntos;
+ * retorna -1 se o chip ja estiver convertendo (BSY ou CONV em 1). O fim da conversao (~200 ms) pode ser
+ * acompanhado com ds3231_conversion_done().
+ * */
+int ds3231_start_conversion(void)
+{
+	i2c1_readMemoryMulti(DS3231_ADDR,DS3231_REG_CONTROL,&regs[DS3231_REG_CONTROL],2);
+	if((regs[DS3231_REG_STATUS]&DS3231_STAT_BSY) || (regs[DS3231_REG_CONTROL]&DS3231_CTRL_CONV))
+	{
+		return -1;
+	}
+	regs[DS3231_REG_CONTROL]|=DS3231_CTRL_CONV;
+	i2c1_MemoryWrite_Byte(DS3231_ADDR,DS3231_REG_CONTROL,regs[DS3231_REG_CONTROL]);
+	return 0;
+}
+
+int ds3231_conversion_done(void)
+{
+	i2c1_readMemoryByte(DS3231_ADDR,DS3231_REG_CONTROL,&regs[DS3231_REG_CONTROL]);
+	return !(regs[DS3231_REG_CONTROL]&DS3231_CTRL_CONV);
+}
+
+/*
+ * Ajusta o registrador de envelhecimento (aging offset, ~0,1 ppm por passo a 25 C; positivo deixa o relogio mais
+ * lento). O novo valor so e aplicado ao cristal na proxima conversao de temperatura, entao, se o chip estiver livre,
+ * controle (com CONV), status (sem apagar flags) e aging sao escritos juntos numa unica transacao de 3 bytes.
+ * Retorna 0 se a conversao foi iniciada ou 1 se o valor so vale a partir da proxima conversao automatica (64 s).
+ * */
+int ds3231_set_aging(int8_t offset)
+{
+	regs[DS3231_REG_AGING]=(uint8_t)offset;
+	i2c1_readMemoryMulti(DS3231_ADDR,DS3231_REG_CONTROL,&regs[DS3231_REG_CONTROL],2);
+	if((regs[DS3231_REG_STATUS]&DS3231_STAT_BSY) || (regs[DS3231_REG_CONTROL]&DS3231_CTRL_CONV))
+	{
+		i2c1_MemoryWrite_Byte(DS3231_ADDR,DS3231_REG_AGING,regs[DS3231_REG_AGING]);
+		return 1;
+	}
+
+	uint8_t block[3];
+	regs[DS3231_REG_CONTROL]|=DS3231_CTRL_CONV;
+	block[0]=regs[DS3231_REG_CONTROL];
+	block[1]=ds3231_status_keep();
+	block[2]=regs[DS3231_REG_AGING];
+	i2c1_writeMemoryMulti(DS3231_ADDR,DS3231_REG_CONTROL,block,3);
+	return 0;
+}
+
+/*
+ * EXTI0: borda de descida da saida SQW, ou seja, inicio de um novo segundo no DS3231 (ou alarme, com INTCN = 1).
+ * */
+void EXTI0_IRQHandler(void)
+{
+	uint32_t now=timebase_cycles();
+	uint32_t interval=now-edge_cycles;
+
+	EXTI->PR=EXTI_PR_PR0;
+	if(!sqw_mode)
+	{
+		// Pino em modo INT: a borda de descida indica alarme; o tratamento (I2C) fica para ds3231_service()
+		alarm_pending=1;
+		return;
+	}
+
+	seq++;
+	edge_cycles=now;
+	if(interval<SQW_MIN_CYCLES || interval>SQW_MAX_CYCLES || ++edge_count>=DS3231_RESYNC_S)
+	{
+		resync=1;
+	}
+	if(++sw_time.seconds>=60)
+	{
+		sw_time.seconds=0;
+		if(++sw_time.minutes>=60)
+		{
+			sw_time.minutes=0;
+			if(++sw_time.hours>=24)
+			{
+				// Virada do dia: a data correta vem do chip na proxima releitura
+				sw_time.hours=0;
+				sw_time.day=sw_time.day%7+1;
+				resync=1;
+			}
+		}
+	}
+	seq++;
+}
@@ -0,0 +1,223 @@
+#include "eelog.h"
+#include "at24c32.h"
+
+/*
+ * Log de registros somente-acrescimo na EEPROM AT24C32, para guardar telemetria durante falta de energia.
+ *
+ * Formato de cada registro: [tamanho][dados ...][CRC-16 baixo][CRC-16 alto]. O CRC cobre o numero de geracao do log,
+ * o tamanho e os dados. Na inicializacao o log e percorrido a partir de EELOG_FIRST ate o primeiro registro invalido,
+ * que marca o fim:
+ *  - uma escrita interrompida por falta de energia deixa um registro com CRC errado, que vira o fim do log e e
+ *    sobrescrito pelo proximo eelog_append();
+ *  - eelog_clear() nao apaga a EEPROM, apenas incrementa a geracao: os registros antigos continuam la, mas o CRC deles
+ *    foi calculado com a geracao anterior e nao confere mais. Apagar o log custa uma unica escrita de 4 bytes.
+ *
+ * A geracao fica em dois cabecalhos (enderecos 0 e 4, cada um com geracao + CRC-16), gravados alternadamente; vale o
+ * cabecalho valido com a maior geracao. Se a energia cair durante eelog_clear(), o outro cabecalho continua valido.
+ * */
+
+#define EELOG_REC_OVERHEAD	3U		// tamanho + CRC-16
+
+static uint16_t generation;
+static uint16_t end;				// endereco onde o proximo registro sera gravado
+static uint16_t count;
+
+/* CRC-16/CCITT-FALSE (polinomio 0x1021), sem tabela para nao gastar flash */
+static uint16_t crc16(uint16_t crc, const uint8_t *data, uint16_t length)
+{
+	while(length--)
+	{
+		crc^=(uint16_t)(*data++)<<8;
+		for(uint8_t i=0;i<8;i++)
+		{
+			crc=(crc&0x8000)?(uint16_t)((crc<<1)^0x1021):(uint16_t)(crc<<1);
+		}
+	}
+	return crc;
+}
+
+static uint16_t eelog_record_crc(const uint8_t *record, uint8_t length)
+{
+	uint8_t gen[2]={generation&0xFF,generation>>8};
+	return crc16(crc16(0xFFFF,gen,2),record,length+1U);
+}
+
+/* Le um cabecalho; retorna 1 e preenche gen se ele for valido */
+static int eelog_read_header(uint16_t addr, uint16_t *gen)
+{
+	uint8_t h[4];
+	if(at24c32_read(addr,h,4)<0)
+	{
+		return -1;
+	}
+	if(crc16(0xFFFF,h,2)!=(uint16_t)(h[2]|(h[3]<<8)))
+	{
+		return 0;
+	}
+	*gen=(uint16_t)(h[0]|(h[1]<<8));
+	return 1;
+}
+
+static int eelog_write_header(uint16_t gen)
+{
+	uint8_t h[4]={gen&0xFF,gen>>8,0,0};
+	uint16_t crc=crc16(0xFFFF,h,2);
+	h[2]=crc&0xFF;
+	h[3]=crc>>8;
+	return at24c32_write((gen&1U)?4:0,h,4);
+}
+
+/*
+ * Le o registro em *cursor. Retorna o tamanho dos dados (e avanca o cursor), 0 no fim do log ou -1 em erro.
+ * */
+static int eelog_read_record(uint16_t *cursor, uint8_t *record)
+{
+	if(*cursor+EELOG_REC_OVERHEAD+1U>AT24C32_SIZE)
+	{
+		return 0;
+	}
+	if(at24c32_read(*cursor,record,1)<0)
+	{
+		return -1;
+	}
+	uint8_t length=record[0];
+	if(length==0 || length>EELOG_MAX_PAYLOAD || *cursor+EELOG_REC_OVERHEAD+length>AT24C32_SIZE)
+	{
+		return 0;
+	}
+	if(at24c32_read(*cursor+1U,&record[1],length+2U)<0)
+	{
+		return -1;
+	}
+	if(eelog_record_crc(record,length)!=(uint16_t)(record[length+1]|(record[length+2]<<8)))
+	{
+		return 0;
+	}
+	*cursor+=EELOG_REC_OVERHEAD+length;
+	return length;
+}
+
+/* Encontra a geracao atual e o fim do log. Retorna a quantidade de registros ou -1 em erro. */
+int eelog_init(void)
+{
+	uint16_t g0=0;
+	uint16_t g1=0;
+	int v0=eelog_read_header(0,&g0);
+	int v1=eelog_read_header(4,&g1);
+	uint8_t record[EELOG_MAX_PAYLOAD+EELOG_REC_OVERHEAD];
+
+	if(v0<0 || v1<0)
+	{
+		return -1;
+	}
+	if(!v0 && !v1)
+	{
+		// EEPROM nova: comeca na geracao 1
+		generation=1;
+		if(eelog_write_header(generation)<0)
+		{
+			return -1;
+		}
+	}
+	else if(v0 && v1)
+	{
+		generation=((int16_t)(g1-g0)>0)?g1:g0;
+	}
+	else
+	{
+		generation=v0?g0:g1;
+	}
+
+	end=EELOG_FIRST;
+	count=0;
+	for(;;)
+	{
+		int r=eelog_read_record(&end,record);
+		if(r<0)
+		{
+			return -1;
+		}
+		if(r==0)
+		{
+			break;
+		}
+		count++;
+	}
+	return count;
+}
+
+/*
+ * Acrescenta um registro. A escrita e feita de uma vez (dividida so nos limites de pagina) e volta sem esperar o
+ * fim da gravacao; o ACK polling da proxima operacao cuida disso. Retorna -1 se o log estiver cheio.
+ * */
+int eelog_append(const void *payload, uint8_t length)
+{
+	uint8_t record[EELOG_MAX_PAYLOAD+EELOG_REC_OVERHEAD];
+	const uint8_t *p=payload;
+
+	if(length==0 || length>EELOG_MAX_PAYLOAD || end+EELOG_REC_OVERHEAD+length>AT24C32_SIZE)
+	{
+		return -1;
+	}
+	record[0]=length;
+	for(uint8_t i=0;i<length;i++)
+	{
+		record[i+1]=p[i];
+	}
+	uint16_t crc=eelog_record_crc(record,length);
+	record[length+1]=crc&0xFF;
+	record[length+2]=crc>>8;
+
+	if(at24c32_write(end,record,length+EELOG_REC_OVERHEAD)<0)
+	{
+		return -1;
+	}
+	end+=length+EELOG_REC_OVERHEAD;
+	count++;
+	return 0;
+}
+
+/*
+ * Percorre o log: *cursor deve comecar em EELOG_FIRST. Copia ate max bytes de dados e retorna o tamanho do
+ * registro, 0 no fim do log ou -1 em erro.
+ * */
+int eelog_read(uint16_t *cursor, void *payload, uint8_t max)
+{
+	uint8_t record[EELOG_MAX_PAYLOAD+EELOG_REC_OVERHEAD];
+	uint8_t *p=payload;
+
+	if(*cursor>=end)
+	{
+		return 0;
+	}
+	int r=eelog_read_record(cursor,record);
+	for(int i=0;i<r && i<max;i++)
+	{
+		p[i]=record[i+1];
+	}
+	return r;
+}
+
+/* Descarta todos os registros trocando de geracao */
+int eelog_clear(void)
+{
+	if(eelog_write_header(generation+1U)<0)
+	{
+		return -1;
+	}
+	generation++;
+	end=EELOG_FIRST;
+	count=0;
+	return 0;
+}
+
+uint16_t eelog_count(void)
+{
+	return count;
+}
+
+/* Espaco livre em bytes (cada registro ocupa o tamanho dos dados + 3) */
+uint16_t eelog_free(void)
+{
+	return AT24C32_SIZE-end;
+}
@@ -1,71 +1,217 @@
 
 #include "i2c.h"
 #include "stm32f1xx.h"
+#include "timebase.h"
 
 /*
- * Esta função configura a interface I2C no microcontrolador STM32. Ela faz a configuração dos pinos GPIOB 6 e 7,
- * que são usados como SCL (clock) e SDA (dados) respectivamente, para operar no modo "open-drain" alternativo.
- * Além disso, habilita o relógio para o I2C1 e configura o periférico I2C para operar com uma frequência de 8 MHz,
- * ajustando também o tempo de subida (TRISE) e os registros de controle do I2C (CCR e CR1).
+ * Driver I2C para os dois barramentos do STM32F103 (I2C1 e I2C2). Todas as funcoes recebem o barramento (i2c_bus_t)
+ * em vez de usar I2C1 e os pinos PB6/PB7 fixos; as funcoes i2c1_* de i2c.h continuam existindo para os drivers que
+ * so usam o I2C1.
  *
+ * Cada barramento tem duas interfaces:
+ * 	- funcoes bloqueantes (i2c_readMemoryMulti() etc.), que fazem a transacao inteira esperando as flags;
+ * 	- uma fila de transferencias (i2c_submit()) atendida pelas interrupcoes de evento e de erro. Como cada barramento
+ * 	  tem sua propria fila e sua propria maquina de estados, o I2C1 e o I2C2 trabalham ao mesmo tempo, cada um no
+ * 	  seu ritmo, sem a CPU esperar por nenhum deles. Os dados de transferencias longas (I2C_DMA_MIN bytes ou mais)
+ * 	  passam pelo DMA, com uma unica interrupcao no fim em vez de uma por byte.
+ *
+ * As duas interfaces nao devem ser misturadas no mesmo barramento ao mesmo tempo: as funcoes bloqueantes esperam a
+ * fila esvaziar antes de comecar, entao nao podem ser chamadas de dentro de uma callback de transferencia.
  * */
 
-void i2c_init()
-{
-	/*Habilita o GPIOB*/
-	RCC->APB2ENR|=RCC_APB2ENR_IOPBEN;
+/* Clock do APB1 em MHz: HSI de 8 MHz sem divisor */
+#define I2C_PCLK1_MHZ	8U
 
-	/*habilitia o PB6 como output 50MHz*/
-	// SDL
-	GPIOB->CRL|=GPIO_CRL_MODE6;
-	GPIOB->CRL|=GPIO_CRL_CNF6;
+/* Fases da maquina de estados da fila */
+#define PH_IDLE			0
+#define PH_START		1	// esperando SB do primeiro START
+#define PH_ADDR_W		2	// endereco com escrita enviado
+#define PH_TX			3	// enviando registrador e dados
+#define PH_RESTART		4	// esperando SB do START repetido
+#define PH_ADDR_R		5	// endereco com leitura enviado
+#define PH_RX			6	// recebendo dados
+#define PH_RX_DMA		7	// recebendo dados pelo DMA
 
-	/*Habilita PB7 para output 50MHz*/
-	// SDA
-	GPIOB->CRL|=GPIO_CRL_MODE7;
-	GPIOB->CRL|=GPIO_CRL_CNF7;
+/*
+ * Espera maxima pelo STOP anterior antes de pedir o START seguinte: o tempo de um byte a 100 kHz. O STOP e pedido no
+ * ultimo evento da transferencia anterior e normalmente sai em um periodo de SCL (10 us).
+ * */
+#define I2C_STOP_WAIT_US	100U
 
-	RCC->APB2ENR|=RCC_APB2ENR_AFIOEN;
+i2c_bus_t i2c_bus1={.regs=I2C1,.rcc_en=RCC_APB1ENR_I2C1EN,.scl_pin=I2C1_SCL_PIN,.ev_irq=I2C1_EV_IRQn,.er_irq=I2C1_ER_IRQn,.dma_tx=DMA1_Channel6,
+		.dma_rx=DMA1_Channel7,.dma_rx_irq=DMA1_Channel7_IRQn,.dma_rx_ifcr=DMA_IFCR_CGIF7};
+#if I2C_USE_I2C2
+i2c_bus_t i2c_bus2={.regs=I2C2,.rcc_en=RCC_APB1ENR_I2C2EN,.scl_pin=I2C2_SCL_PIN,.ev_irq=I2C2_EV_IRQn,.er_irq=I2C2_ER_IRQn,.dma_tx=DMA1_Channel4,
+		.dma_rx=DMA1_Channel5,.dma_rx_irq=DMA1_Channel5_IRQn,.dma_rx_ifcr=DMA_IFCR_CGIF5};
+#endif
 
-	/*Habilita o clock  I2C1*/
-	RCC->APB1ENR|=RCC_APB1ENR_I2C1EN;
+/*
+ * Esta função configura um barramento I2C. Os pinos SCL e SDA (PB6/PB7, PB8/PB9 ou PB10/PB11) são configurados como
+ * saída alternativa "open-drain", o clock do periférico é habilitado e o I2C é programado para o clock de 8 MHz do
+ * APB1, com CCR e TRISE calculados para 100 kHz (modo padrão) ou ~400 kHz (modo rápido).
+ *
+ * */
+void i2c_bus_init(i2c_bus_t *bus, uint32_t speed)
+{
+	I2C_TypeDef *i2c=bus->regs;
+	volatile uint32_t *cr=(bus->scl_pin<8)?&GPIOB->CRL:&GPIOB->CRH;
+
+	RCC->APB2ENR|=RCC_APB2ENR_IOPBEN|RCC_APB2ENR_AFIOEN;
+	RCC->APB1ENR|=bus->rcc_en;
+	RCC->AHBENR|=RCC_AHBENR_DMA1EN;
+
+	/* SCL e SDA: saida alternativa open-drain, 50 MHz */
+	*cr|=0xFFU<<((bus->scl_pin&7)*4);
+#if I2C1_REMAP
+	if(i2c==I2C1)
+	{
+		AFIO->MAPR|=AFIO_MAPR_I2C1_REMAP;
+	}
+#endif
 
+	i2c->CR1=I2C_CR1_SWRST;
+	i2c->CR1=0;
+	i2c->CR2=I2C_PCLK1_MHZ<<I2C_CR2_FREQ_Pos;
+	if(speed>I2C_SPEED_STANDARD)
+	{
+		// Modo rapido, DUTY=0: Tlow = 2*Thigh, periodo = 3*CCR ciclos do APB1 (arredondado para baixo na frequencia)
+		i2c->CCR=I2C_CCR_FS|((I2C_PCLK1_MHZ*1000000U+3*speed-1)/(3*speed));
+		i2c->TRISE=I2C_PCLK1_MHZ*300U/1000U+1;	// 300 ns
+	}
+	else
+	{
+		i2c->CCR=I2C_PCLK1_MHZ*1000000U/(2*speed);	// 0x28 a 100 kHz
+		i2c->TRISE=I2C_PCLK1_MHZ+1;					// 1000 ns
+	}
 
-	/*Chama o periferico com o  clock is 8MHz*/
-	I2C1->CR2&=~(I2C_CR2_FREQ);
-	I2C1->CR2|=(8<<I2C_CR2_FREQ_Pos);
-	// habilita o rise time*/
-	I2C1->TRISE=9;
+	// DMA de transmissao: memoria -> DR, 8 bits, so o endereco de memoria incrementa
+	bus->dma_tx->CCR=0;
+	bus->dma_tx->CPAR=(uint32_t)&i2c->DR;
+	bus->dma_tx->CCR=DMA_CCR_DIR|DMA_CCR_MINC|DMA_CCR_PL_0;
+	// DMA de recepcao: DR -> memoria, com interrupcao no fim para gerar o STOP
+	bus->dma_rx->CCR=0;
+	bus->dma_rx->CPAR=(uint32_t)&i2c->DR;
+	bus->dma_rx->CCR=DMA_CCR_MINC|DMA_CCR_PL_0|DMA_CCR_TCIE;
+
+	bus->head=NULL;
+	bus->tail=NULL;
+	bus->phase=PH_IDLE;
+	NVIC_EnableIRQ(bus->ev_irq);
+	NVIC_EnableIRQ(bus->er_irq);
+	NVIC_EnableIRQ(bus->dma_rx_irq);
+
+	i2c->CR1|=I2C_CR1_PE;
+}
 
-	I2C1->CCR|=0x28;
+/* As funcoes bloqueantes esperam a fila do barramento esvaziar antes de usar o periferico */
+static I2C_TypeDef *i2c_claim(i2c_bus_t *bus)
+{
+	while(bus->head!=NULL){;}
+	return bus->regs;
+}
 
-	I2C1->CR1|=I2C_CR1_PE;
+/*
+ * Espera limitada por uma flag de SR1. Retorna 0 se o tempo limite (I2C_TIMEOUT iteracoes) estourar, evitando que
+ * um dispositivo travado ou um barramento sem pull-up prenda o programa para sempre.
+ * */
+static uint32_t i2c_wait_sr1(i2c_bus_t *bus, uint32_t mask)
+{
+	I2C_TypeDef *i2c=bus->regs;
+	uint32_t timeout=I2C_TIMEOUT;
+	uint32_t sr1;
+	do
+	{
+		sr1=i2c->SR1;
+	} while(!(sr1&mask) && --timeout);
+	return sr1&mask;
 }
 
+/*
+ * Testa se existe um dispositivo no endereco saddr. Envia START + endereco (escrita) e espera ADDR (ACK) ou AF (NACK),
+ * o que vier primeiro, em vez de esperar um tempo fixo. Em seguida gera o STOP e espera o hardware limpar o bit STOP,
+ * que so acontece depois que a condicao de parada foi realmente enviada.
+ *
+ * Retorna 1 se o dispositivo respondeu, 0 se nao respondeu e -1 em caso de erro no barramento (timeout).
+ * */
+int i2c_probe(i2c_bus_t *bus, uint8_t saddr)
+{
+	I2C_TypeDef *i2c=i2c_claim(bus);
+	uint32_t sr1;
+	uint32_t timeout;
+
+	i2c->CR1|=I2C_CR1_START;
+	if(!i2c_wait_sr1(bus,I2C_SR1_SB))
+	{
+		i2c->CR1|=I2C_CR1_STOP;
+		return -1;
+	}
+	i2c->DR=saddr<<1;
+	sr1=i2c_wait_sr1(bus,I2C_SR1_ADDR|I2C_SR1_AF|I2C_SR1_BERR|I2C_SR1_ARLO);
+	if(sr1&I2C_SR1_ADDR)
+	{
+		(void)i2c->SR2;			// Limpa ADDR (leitura de SR1 seguida de SR2)
+	}
+	i2c->CR1|=I2C_CR1_STOP;
+	i2c->SR1=(uint16_t)~(I2C_SR1_AF|I2C_SR1_BERR|I2C_SR1_ARLO); // Flags rc_w0: escrever 0 limpa, escrever 1 nao altera
+
+	timeout=I2C_TIMEOUT;
+	while((i2c->CR1&I2C_CR1_STOP) && --timeout){;}
+	if(!timeout || !(sr1&(I2C_SR1_ADDR|I2C_SR1_AF)))
+	{
+		return -1;
+	}
+	return (sr1&I2C_SR1_ADDR)?1:0;
+}
 
-static void delay(uint32_t delay)
+/*
+ * Varredura rapida do barramento. Preenche map com 128 bits (map[addr>>5] bit (addr&31)) indicando os enderecos que
+ * responderam. Com skip_reserved diferente de 0 os enderecos reservados 0x00-0x07 e 0x78-0x7F nao sao testados.
+ *
+ * Nao ha atraso fixo nem printf dentro do laco: cada teste custa apenas START + 9 bits + STOP (~0,1 ms a 100 kHz),
+ * entao a varredura completa leva ~12 ms a 100 kHz e ~3 ms a 400 kHz. Pode ser chamada periodicamente; comparando
+ * (XOR) o mapa novo com o anterior detecta dispositivos conectados ou removidos com o sistema ligado.
+ *
+ * Retorna a quantidade de dispositivos encontrados ou -1 se o barramento travou.
+ * */
+int i2c_scan_fast(i2c_bus_t *bus, uint32_t map[4], uint8_t skip_reserved)
 {
-	for (volatile int i=0;i<1000;i++);
+	uint8_t first=skip_reserved?0x08:0x00;
+	uint8_t last=skip_reserved?0x77:0x7F;
+	int found=0;
+
+	map[0]=map[1]=map[2]=map[3]=0;
+	for(uint8_t i=first;i<=last;i++)
+	{
+		int r=i2c_probe(bus,i);
+		if(r<0)
+		{
+			return -1;
+		}
+		if(r)
+		{
+			map[i>>5]|=(1UL<<(i&31));
+			found++;
+		}
+	}
+	return found;
 }
 
 /*
- * Esta função varre os endereços do barramento I2C (0 a 127) para encontrar dispositivos conectados. Ela envia um "start condition"
- * , transmite o endereço do dispositivo e verifica se houve resposta, indicando que um dispositivo está presente nesse endereço.
- * Se encontrado, o endereço do dispositivo é impresso via printf().
+ * Esta função varre os endereços do barramento I2C (0 a 127) para encontrar dispositivos conectados. A varredura em si é
+ * feita por i2c_scan_fast(); os endereços encontrados só são impressos via printf() depois que o barramento foi todo
+ * testado, para que o tempo da UART não entre no tempo da varredura.
  * */
-void i2c1_scan_bus(void)
+void i2c_scan_bus(i2c_bus_t *bus)
 {
-	int a=0;
+	uint32_t map[4];
+	if(i2c_scan_fast(bus,map,0)<0)
+	{
+		printf("I2C bus error during scan\r\n");
+		return;
+	}
 	for (uint8_t i=0;i<128;i++)
 	{
-		I2C1->CR1 |= I2C_CR1_START;
-		while(!(I2C1->SR1 & I2C_SR1_SB));
-		I2C1->DR=(i<<1|0);
-		while(!(I2C1->SR1)|!(I2C1->SR2)){};
-		I2C1->CR1 |= I2C_CR1_STOP;
-		delay(100);      //o minimo de espera é 40 uS, mas é interessante deixar 100uS
-		a=(I2C1->SR1&I2C_SR1_ADDR);
-		if (a==2)
+		if (I2C_BITMAP_TEST(map,i))
 		{
 			printf("Found I2C device at address 0x%X (hexadecimal), or %d (decimal)\r\n",i,i);
 		}
@@ -78,20 +224,21 @@ void i2c1_scan_bus(void)
  *
  * */
 
-void i2c1_MemoryWrite_Byte(uint8_t saddr, uint8_t maddr, uint8_t data)
+void i2c_MemoryWrite_Byte(i2c_bus_t *bus, uint8_t saddr, uint8_t maddr, uint8_t data)
 {
-	while(I2C1->SR2&I2C_SR2_BUSY){;}
-	I2C1->CR1|=I2C_CR1_START;
-	while(!(I2C1->SR1&I2C_SR1_SB)){;}
-	I2C1->DR = saddr<< 1;
-	while(!(I2C1->SR1&I2C_SR1_ADDR)){;}
-	(void)I2C1->SR2;
-	while(!(I2C1->SR1&I2C_SR1_TXE)){;}
-	I2C1->DR = maddr;
-	while(!(I2C1->SR1&I2C_SR1_TXE)){;}
-	I2C1->DR = data;
-	while (!(I2C1->SR1 & I2C_SR1_BTF));
-	I2C1->CR1 |=I2C_CR1_STOP;
+	I2C_TypeDef *i2c=i2c_claim(bus);
+	while(i2c->SR2&I2C_SR2_BUSY){;}
+	i2c->CR1|=I2C_CR1_START;
+	while(!(i2c->SR1&I2C_SR1_SB)){;}
+	i2c->DR = saddr<< 1;
+	while(!(i2c->SR1&I2C_SR1_ADDR)){;}
+	(void)i2c->SR2;
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}
+	i2c->DR = maddr;
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}
+	i2c->DR = data;
+	while (!(i2c->SR1 & I2C_SR1_BTF));
+	i2c->CR1 |=I2C_CR1_STOP;
 }
 
 
@@ -101,43 +248,45 @@ void i2c1_MemoryWrite_Byte(uint8_t saddr, uint8_t maddr, uint8_t data)
  *
  *
  * */
-void i2c1_Write_Byte(uint8_t saddr, uint8_t data)
+void i2c_Write_Byte(i2c_bus_t *bus, uint8_t saddr, uint8_t data)
 {
-	while(I2C1->SR2&I2C_SR2_BUSY){;}          // espera ate que o barramento nao esteja ocupado (Habilita o bit 1 "busy")
-	I2C1->CR1|=I2C_CR1_START;                  // gera o inicial (habilita o bit 8)
-	while(!(I2C1->SR1&I2C_SR1_SB)){;}         // espera ate o inicio seja gerado (Habilita o bit 0)
-	I2C1->DR = saddr<< 1;                 	 // Após o início ser gerado, envie o endereço do escravo deslocado para a esquerda em 1 bit.
-	while(!(I2C1->SR1&I2C_SR1_ADDR)){;}      // aguarde ate o enderenco seja definido (Habilita o bit 1)
-	(void)I2C1->SR2; 						  // Limpa SR2
-	while(!(I2C1->SR1&I2C_SR1_TXE)){;}       //Aguarde até que o buffer de transmissão esteja vazio verificando o bit TXE no registro SR1:
-	I2C1->DR = data;                        /* send memory address*/
-	while (!(I2C1->SR1 & I2C_SR1_BTF));      /*wait until transfer finished*/
-	I2C1->CR1 |=I2C_CR1_STOP;				/*Generate Stop*/
+	I2C_TypeDef *i2c=i2c_claim(bus);
+	while(i2c->SR2&I2C_SR2_BUSY){;}          // espera ate que o barramento nao esteja ocupado (Habilita o bit 1 "busy")
+	i2c->CR1|=I2C_CR1_START;                  // gera o inicial (habilita o bit 8)
+	while(!(i2c->SR1&I2C_SR1_SB)){;}         // espera ate o inicio seja gerado (Habilita o bit 0)
+	i2c->DR = saddr<< 1;                 	 // Após o início ser gerado, envie o endereço do escravo deslocado para a esquerda em 1 bit.
+	while(!(i2c->SR1&I2C_SR1_ADDR)){;}      // aguarde ate o enderenco seja definido (Habilita o bit 1)
+	(void)i2c->SR2; 						  // Limpa SR2
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}       //Aguarde até que o buffer de transmissão esteja vazio verificando o bit TXE no registro SR1:
+	i2c->DR = data;                        /* send memory address*/
+	while (!(i2c->SR1 & I2C_SR1_BTF));      /*wait until transfer finished*/
+	i2c->CR1 |=I2C_CR1_STOP;				/*Generate Stop*/
 }
 
 /* Lê um único byte de uma memória interna de um dispositivo I2C. A função envia o endereço do dispositivo (saddr),
  * o endereço de memória (maddr), e lê o dado da memória para a variável data
  * */
-void i2c1_readMemoryByte(uint8_t saddr,uint8_t maddr, uint8_t *data)
+void i2c_readMemoryByte(i2c_bus_t *bus, uint8_t saddr,uint8_t maddr, uint8_t *data)
 {
-	while(I2C1->SR2&I2C_SR2_BUSY){;}
-	I2C1->CR1|=I2C_CR1_START;
-	while(!(I2C1->SR1&I2C_SR1_SB)){;}
-	I2C1->DR=saddr<<1;
-	while(!(I2C1->SR1&I2C_SR1_ADDR)){;}
-	(void)I2C1->SR2;
-	while(!(I2C1->SR1&I2C_SR1_TXE)){;}
-	I2C1->DR=maddr;
-	while(!(I2C1->SR1&I2C_SR1_TXE)){;}
-	I2C1->CR1|=I2C_CR1_START;
-	while(!(I2C1->SR1&I2C_SR1_SB)){;}
-	I2C1->DR=saddr<<1|1;
-	while(!(I2C1->SR1&I2C_SR1_ADDR)){;}
-	I2C1->CR1&=~I2C_CR1_ACK;
-	(void)I2C1->SR2;
-	I2C1->CR1|=I2C_CR1_STOP;
-	while(!(I2C1->SR1&I2C_SR1_RXNE)){;}
-	*data=I2C1->DR;
+	I2C_TypeDef *i2c=i2c_claim(bus);
+	while(i2c->SR2&I2C_SR2_BUSY){;}
+	i2c->CR1|=I2C_CR1_START;
+	while(!(i2c->SR1&I2C_SR1_SB)){;}
+	i2c->DR=saddr<<1;
+	while(!(i2c->SR1&I2C_SR1_ADDR)){;}
+	(void)i2c->SR2;
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}
+	i2c->DR=maddr;
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}
+	i2c->CR1|=I2C_CR1_START;
+	while(!(i2c->SR1&I2C_SR1_SB)){;}
+	i2c->DR=saddr<<1|1;
+	while(!(i2c->SR1&I2C_SR1_ADDR)){;}
+	i2c->CR1&=~I2C_CR1_ACK;
+	(void)i2c->SR2;
+	i2c->CR1|=I2C_CR1_STOP;
+	while(!(i2c->SR1&I2C_SR1_RXNE)){;}
+	*data=i2c->DR;
 }
 /* Lê um único byte de um dispositivo I2C sem especificar um endereço de memória. É útil para dispositivos que respondem com
  * dados diretamente sem um esquema de endereçamento de memória interno.
@@ -147,18 +296,19 @@ void i2c1_readMemoryByte(uint8_t saddr,uint8_t maddr, uint8_t *data)
  * 		interno de memória, ou quando se quer apenas transmitir dados diretamente.
  * */
 
-void i2c1_readByte(uint8_t saddr, uint8_t *data)
+void i2c_readByte(i2c_bus_t *bus, uint8_t saddr, uint8_t *data)
 {
-	while(I2C1->SR2&I2C_SR2_BUSY){;}
-	I2C1->CR1|=I2C_CR1_START;
-	while(!(I2C1->SR1&I2C_SR1_SB)){;}
-	I2C1->DR=saddr<<1|1;
-	while(!(I2C1->SR1&I2C_SR1_ADDR)){;}
-	I2C1->CR1&=~I2C_CR1_ACK;
-	(void)I2C1->SR2;
-	I2C1->CR1|=I2C_CR1_STOP;
-	while(!(I2C1->SR1&I2C_SR1_RXNE)){;}
-	*data=I2C1->DR;
+	I2C_TypeDef *i2c=i2c_claim(bus);
+	while(i2c->SR2&I2C_SR2_BUSY){;}
+	i2c->CR1|=I2C_CR1_START;
+	while(!(i2c->SR1&I2C_SR1_SB)){;}
+	i2c->DR=saddr<<1|1;
+	while(!(i2c->SR1&I2C_SR1_ADDR)){;}
+	i2c->CR1&=~I2C_CR1_ACK;
+	(void)i2c->SR2;
+	i2c->CR1|=I2C_CR1_STOP;
+	while(!(i2c->SR1&I2C_SR1_RXNE)){;}
+	*data=i2c->DR;
 
 }
 
@@ -183,57 +333,58 @@ void i2c1_readByte(uint8_t saddr, uint8_t *data)
  *
  * */
 
-void i2c1_readMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length)
+void i2c_readMemoryMulti(i2c_bus_t *bus, uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length)
 {
+	I2C_TypeDef *i2c=i2c_claim(bus);
 	// 26.6.7 I2C Status register 1 (I2C_SR2)
 	// Dentro da função, começamos esperando até que o barramento esteja livre pelo bit pronto e ocupado do registrador SR1
-	while (I2C1->SR2 & I2C_SR2_BUSY){;} // (Habilita o bit 1 "busy")
+	while (i2c->SR2 & I2C_SR2_BUSY){;} // (Habilita o bit 1 "busy")
 
 	//26.6.1 I2C Control register 1 (I2C_CR1)
-	I2C1->CR1|=I2C_CR1_START; // Após o barramento ser liberado, envie a condição de início definindo o bit start em CR1 como 1,
-	while(!(I2C1->SR1 & I2C_SR1_SB)){;} //  Aguarde até que a condição inicial seja gerada
-	I2C1->DR=saddr<<1; //  envie o endereço do escravo deslocado para a esquerda em 1 bit
+	i2c->CR1|=I2C_CR1_START; // Após o barramento ser liberado, envie a condição de início definindo o bit start em CR1 como 1,
+	while(!(i2c->SR1 & I2C_SR1_SB)){;} //  Aguarde até que a condição inicial seja gerada
+	i2c->DR=saddr<<1; //  envie o endereço do escravo deslocado para a esquerda em 1 bit
 
 	//26.6.6 I2C Status register 1 (I2C_SR1)
-	while(!(I2C1->SR1 & I2C_SR1_ADDR)){;} // Aguarde até que o endereço seja correspondido verificando o bit ADDR no registro SR1
-	(void)I2C1->SR2; // Limpar registro SR2
+	while(!(i2c->SR1 & I2C_SR1_ADDR)){;} // Aguarde até que o endereço seja correspondido verificando o bit ADDR no registro SR1
+	(void)i2c->SR2; // Limpar registro SR2
 
 	//26.6.6 I2C Status register 1 (I2C_SR1)
-	while(!(I2C1->SR1&I2C_SR1_TXE)){;}// Aguarde até que o buffer de transmissão esteja vazio verificando o bit TXE no registro SR1
-	I2C1->DR = maddr; // Envie o endereço de memória
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}// Aguarde até que o buffer de transmissão esteja vazio verificando o bit TXE no registro SR1
+	i2c->DR = maddr; // Envie o endereço de memória
 
-	while(!(I2C1->SR1&I2C_SR1_TXE)){;}// Aguarde até que o buffer de transmissão esteja vazio
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}// Aguarde até que o buffer de transmissão esteja vazio
 
 	/* Para mudar a direção de gravação para leitura, precisamos enviar a condição de reinicialização seguida do envio do endereço
 	 * do escravo no modo de leitura.
 	 *
 	 * */
-	I2C1->CR1|=I2C_CR1_START; // Para gerar a condição de reinicialização, gere outra condição de início
-	while(!(I2C1->SR1 & I2C_SR1_SB)){;} // Aguarde até que a condição inicial seja gerada
-	I2C1->DR=saddr<<1|1;  // envie o endereço salve com a operação de leitura
-	while(!(I2C1->SR1 & I2C_SR1_ADDR)){;} // Aguarde até que o endereço seja correspondido
-	(void)I2C1->SR2; // Limpar registro SR2
+	i2c->CR1|=I2C_CR1_START; // Para gerar a condição de reinicialização, gere outra condição de início
+	while(!(i2c->SR1 & I2C_SR1_SB)){;} // Aguarde até que a condição inicial seja gerada
+	i2c->DR=saddr<<1|1;  // envie o endereço salve com a operação de leitura
+	while(!(i2c->SR1 & I2C_SR1_ADDR)){;} // Aguarde até que o endereço seja correspondido
+	(void)i2c->SR2; // Limpar registro SR2
 
 	// 26.6.1 I2C Control register 1 (I2C_CR1)
 	/* Esse bit controla se o dispositivo enviará um sinal de reconhecimento (ACK) depois de receber um byte de dados ou endereço
 	 * válido. Se estiver em 1, o dispositivo envia o ACK, indicando que recebeu os dados corretamente. Se estiver em 0, ele não
 	 * envia o ACK, o que pode ser usado para indicar que o dado não foi aceito.
 	 * */
-	I2C1->CR1|=I2C_CR1_ACK; // Habilitar reconhecimento no registro CR1
+	i2c->CR1|=I2C_CR1_ACK; // Habilitar reconhecimento no registro CR1
 	while(length>0U) // Caso tenhamos apenas um byte restante, devemos fazer o seguinte
 	{
 		if(length==1U)
 		{
-			I2C1->CR1&=~I2C_CR1_ACK; // Desabilitar reconhecimento
-			I2C1->CR1|=I2C_CR1_STOP; // Gerar parada
-			while(!(I2C1->SR1&I2C_SR1_RXNE)){;} // Aguarde até que o bit de recebimento seja definido
-			*data++=I2C1->DR; // Armazena o último byte recebido no buffer
+			i2c->CR1&=~I2C_CR1_ACK; // Desabilitar reconhecimento
+			i2c->CR1|=I2C_CR1_STOP; // Gerar parada
+			while(!(i2c->SR1&I2C_SR1_RXNE)){;} // Aguarde até que o bit de recebimento seja definido
+			*data++=i2c->DR; // Armazena o último byte recebido no buffer
 			break;
 		}
 		else
 		{
-			while(!(I2C1->SR1&I2C_SR1_RXNE)){;} // Aguarde até que o bit de recebimento seja definido
-			(*data++)=I2C1->DR; // armazenar os dados no buffer e incrementar o contador de buffer
+			while(!(i2c->SR1&I2C_SR1_RXNE)){;} // Aguarde até que o bit de recebimento seja definido
+			(*data++)=i2c->DR; // armazenar os dados no buffer e incrementar o contador de buffer
 			length--; // decrementar o contador
 
 		}
@@ -250,14 +401,15 @@ void i2c1_readMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t le
  *
  * */
 
-void i2c1_writeMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length)
+void i2c_writeMemoryMulti(i2c_bus_t *bus, uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t length)
 {
+	I2C_TypeDef *i2c=i2c_claim(bus);
 	// 26.6.7 I2C Status register 1 (I2C_SR2)
-	while (I2C1->SR2 & I2C_SR2_BUSY);           // espera ate que o barramento nao esteja ocupado (Habilita o bit 1 "busy")
+	while (i2c->SR2 & I2C_SR2_BUSY);           // espera ate que o barramento nao esteja ocupado (Habilita o bit 1 "busy")
 
 	//26.6.1 I2C Control register 1 (I2C_CR1)
 	// apos o barramento ser liberado, envia a condicao inicial
-	I2C1->CR1 |= I2C_CR1_START;                 // gera o inicial (habilita o bit 8)
+	i2c->CR1 |= I2C_CR1_START;                 // gera o inicial (habilita o bit 8)
 
 	//26.6.6 I2C Status register 1 (I2C_SR1)
 
@@ -265,13 +417,13 @@ void i2c1_writeMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t l
 	 * "start condition" foi gerado, ou seja, o master está pronto para começar a transmissão de dados. Para continuar o
 	 * processo, o software precisa limpar esse bit lendo o status (SR1) e escrevendo um dado (DR).
 	 * */
-	while (!(I2C1->SR1 & I2C_SR1_SB)){;}		// espera ate o inicio seja gerado (Habilita o bit 0)
+	while (!(i2c->SR1 & I2C_SR1_SB)){;}		// espera ate o inicio seja gerado (Habilita o bit 0)
 
 	/* A razão por trás da mudança é que o endereço pega
 	 * o bit1 para o bit7 do registrador de dados e o bit0 é usado para operação de leitura/gravação.
 	 *  Quando o bit0 é 0, a operação é de gravação e quando é 1, significa operação de leitura.
 	 * */
-	I2C1->DR = saddr<< 1;                 	 	// Após o início ser gerado, envie o endereço do escravo deslocado para a esquerda em 1 bit.
+	i2c->DR = saddr<< 1;                 	 	// Após o início ser gerado, envie o endereço do escravo deslocado para a esquerda em 1 bit.
 
 	//26.6.6 I2C Status register 1 (I2C_SR1)
 	/* -	Esse bit (ADDR) basicamente indica se o endereço foi enviado e aceito (modo master) ou se o endereço que o dispositivo recebeu
@@ -280,8 +432,8 @@ void i2c1_writeMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t l
 	 * -	Esse bit é limpo (ou seja, resetado) automaticamente quando o software lê o registro SR1 seguido pelo SR2, ou quando PE=0.
 	 *
 	 * */
-	while (!(I2C1->SR1 & I2C_SR1_ADDR)){;}       // aguarde ate o enderenco seja definido (Habilita o bit 1)
-	(void) I2C1->SR2; 						     // Limpa SR2
+	while (!(i2c->SR1 & I2C_SR1_ADDR)){;}       // aguarde ate o enderenco seja definido (Habilita o bit 1)
+	(void) i2c->SR2; 						     // Limpa SR2
 
 	// 26.6.6 I2C Status register 1 (I2C_SR1)
 	/* Esse bit (TXE) indica se o registro de dados, que armazena os dados a serem enviados, está vazio. Quando está vazio (bit em 1),
@@ -289,15 +441,15 @@ void i2c1_writeMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t l
 	 * transmitindo. Esse bit é automaticamente resetado quando novos dados são enviados, ou quando a comunicação é iniciada ou
 	 * finalizada.
 	 * */
-	while (!(I2C1->SR1 & I2C_SR1_TXE));           //Aguarde até que o buffer de transmissão esteja vazio verificando o bit TXE no registro SR1:
-	I2C1->DR = maddr;                      		// Envie o endereço de memória
+	while (!(i2c->SR1 & I2C_SR1_TXE));           //Aguarde até que o buffer de transmissão esteja vazio verificando o bit TXE no registro SR1:
+	i2c->DR = maddr;                      		// Envie o endereço de memória
 
 	// 26.6.6 I2C Status register 1 (I2C_SR1)
-	while (!(I2C1->SR1 & I2C_SR1_TXE));           // Aguarde até que o buffer de transmissão esteja vazio verificando o bit TXE no registro SR1
+	while (!(i2c->SR1 & I2C_SR1_TXE));           // Aguarde até que o buffer de transmissão esteja vazio verificando o bit TXE no registro SR1
 	for (uint8_t i=0;i<length;i++)
 	{
 
-		I2C1->DR=data[i]; 			//Agora, usando o loop for, enviaremos os dados um após o outro
+		i2c->DR=data[i]; 			//Agora, usando o loop for, enviaremos os dados um após o outro
 
 		/*Esse bit BTF indica quando a transferência de um byte foi concluída com sucesso, seja durante a recepção ou transmissão.
 		 * Se o dispositivo estiver recebendo dados, o bit é ativado quando o byte foi recebido, mas ainda não foi lido.
@@ -305,7 +457,377 @@ void i2c1_writeMemoryMulti(uint8_t saddr,uint8_t maddr, uint8_t *data, uint8_t l
 		 * escrito no registro de dados. Para continuar a operação, o software precisa limpar esse bit, lendo ou escrevendo no
 		 * registro de dados.
 		 * */
-		while (!(I2C1->SR1 & I2C_SR1_BTF));
+		while (!(i2c->SR1 & I2C_SR1_BTF));
+	}
+	i2c->CR1 |= I2C_CR1_STOP; //Depois que todos os dados forem transmitidos, envie a condição de parada
+}
+
+/* Mesma sequência de i2c_readMemoryMulti(), mas para memórias com endereço interno de 16 bits (EEPROMs como a
+ * AT24C32): o endereço é enviado em dois bytes, o mais significativo primeiro, e a quantidade de bytes lidos em
+ * sequência pode passar de 255.
+ * */
+void i2c_readMemory16(i2c_bus_t *bus, uint8_t saddr, uint16_t maddr, uint8_t *data, uint16_t length)
+{
+	I2C_TypeDef *i2c=i2c_claim(bus);
+	while (i2c->SR2 & I2C_SR2_BUSY){;}
+	i2c->CR1|=I2C_CR1_START;
+	while(!(i2c->SR1 & I2C_SR1_SB)){;}
+	i2c->DR=saddr<<1;
+	while(!(i2c->SR1 & I2C_SR1_ADDR)){;}
+	(void)i2c->SR2;
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}
+	i2c->DR = maddr>>8;				// Byte alto do endereço de memória
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}
+	i2c->DR = maddr&0xFF;				// Byte baixo do endereço de memória
+	while(!(i2c->SR1&I2C_SR1_TXE)){;}
+
+	i2c->CR1|=I2C_CR1_START;			// Reinício para mudar para leitura
+	while(!(i2c->SR1 & I2C_SR1_SB)){;}
+	i2c->DR=saddr<<1|1;
+	while(!(i2c->SR1 & I2C_SR1_ADDR)){;}
+	(void)i2c->SR2;
+
+	i2c->CR1|=I2C_CR1_ACK;
+	while(length>0U)
+	{
+		if(length==1U)
+		{
+			i2c->CR1&=~I2C_CR1_ACK;	// NACK no último byte
+			i2c->CR1|=I2C_CR1_STOP;
+			while(!(i2c->SR1&I2C_SR1_RXNE)){;}
+			*data++=i2c->DR;
+			break;
+		}
+		while(!(i2c->SR1&I2C_SR1_RXNE)){;}
+		(*data++)=i2c->DR;
+		length--;
+	}
+}
+
+/* Escrita em memória com endereço interno de 16 bits. Quem chama é responsável por não atravessar o limite de
+ * página do dispositivo.
+ * */
+void i2c_writeMemory16(i2c_bus_t *bus, uint8_t saddr, uint16_t maddr, const uint8_t *data, uint8_t length)
+{
+	I2C_TypeDef *i2c=i2c_claim(bus);
+	while (i2c->SR2 & I2C_SR2_BUSY);
+	i2c->CR1 |= I2C_CR1_START;
+	while (!(i2c->SR1 & I2C_SR1_SB)){;}
+	i2c->DR = saddr<< 1;
+	while (!(i2c->SR1 & I2C_SR1_ADDR)){;}
+	(void) i2c->SR2;
+	while (!(i2c->SR1 & I2C_SR1_TXE));
+	i2c->DR = maddr>>8;
+	while (!(i2c->SR1 & I2C_SR1_TXE));
+	i2c->DR = maddr&0xFF;
+	while (!(i2c->SR1 & I2C_SR1_TXE));
+	for (uint8_t i=0;i<length;i++)
+	{
+		i2c->DR=data[i];
+		while (!(i2c->SR1 & I2C_SR1_BTF));
 	}
-	I2C1->CR1 |= I2C_CR1_STOP; //Depois que todos os dados forem transmitidos, envie a condição de parada
+	i2c->CR1 |= I2C_CR1_STOP;
+}
+
+/*
+ * Gera o START da transferencia na cabeca da fila. O CR1 nao pode ser escrito enquanto o STOP da transferencia
+ * anterior nao sair no barramento. Esta funcao roda dentro das interrupcoes do barramento (prioridade 0) e com PRIMASK
+ * ligado (i2c_submit()), entao nada mais e atendido enquanto ela espera: a espera e limitada a I2C_STOP_WAIT_US pelo
+ * DWT (ligado por timebase_init()), e depois disso o START e pedido de qualquer forma. Pendurar a interrupcao de
+ * evento para tentar de novo nao adiantaria: de prioridade 0 ela reentraria em seguida, sem deixar o EXTI nem o laco
+ * principal rodar.
+ * */
+static void i2c_xfer_start(i2c_bus_t *bus)
+{
+	I2C_TypeDef *i2c=bus->regs;
+	uint32_t t0=timebase_cycles();
+
+	while((i2c->CR1&I2C_CR1_STOP) && timebase_cycles()-t0<I2C_STOP_WAIT_US*TIMEBASE_CYCLES_PER_US);
+	bus->phase=PH_START;
+	bus->index=0;
+	i2c->CR2|=I2C_CR2_ITEVTEN|I2C_CR2_ITERREN;
+	i2c->CR1|=I2C_CR1_START;
+}
+
+/* Encerra a transferencia atual, avisa quem pediu e comeca a proxima da fila */
+static void i2c_xfer_finish(i2c_bus_t *bus, int8_t status)
+{
+	I2C_TypeDef *i2c=bus->regs;
+	i2c_xfer_t *x=bus->head;
+
+	i2c->CR2&=~(I2C_CR2_ITBUFEN|I2C_CR2_DMAEN|I2C_CR2_LAST);
+	bus->dma_tx->CCR&=~DMA_CCR_EN;
+	bus->dma_rx->CCR&=~DMA_CCR_EN;
+	bus->phase=PH_IDLE;
+	bus->head=x->next;
+	if(bus->head==NULL)
+	{
+		bus->tail=NULL;
+		i2c->CR2&=~(I2C_CR2_ITEVTEN|I2C_CR2_ITERREN);
+	}
+	if(status==I2C_XFER_DONE)
+	{
+		bus->completed++;
+	}
+	else
+	{
+		bus->errors++;
+	}
+	x->status=status;
+	if(x->done)
+	{
+		x->done(x);
+	}
+	// A callback pode ter colocado uma transferencia nova na fila vazia, e nesse caso ela ja comecou
+	if(bus->head!=NULL && bus->phase==PH_IDLE)
+	{
+		i2c_xfer_start(bus);
+	}
+}
+
+/*
+ * Coloca uma transferencia no fim da fila do barramento e retorna sem esperar. Se o barramento estiver parado a
+ * transferencia comeca imediatamente. Pode ser chamada de interrupcoes, inclusive de uma callback done.
+ *
+ * head e tail sao alterados com PRIMASK ligado: desligar so as interrupcoes do barramento nao basta, porque outra
+ * interrupcao (o EXTI do MPU-6050, por exemplo) pode chamar i2c_submit() no mesmo barramento no meio da insercao
+ * feita pelo laco principal. O estado anterior de PRIMASK e restaurado, entao a funcao tambem pode ser chamada com
+ * as interrupcoes ja desligadas.
+ * */
+void i2c_submit(i2c_bus_t *bus, i2c_xfer_t *xfer)
+{
+	uint32_t primask;
+
+	xfer->next=NULL;
+	if(xfer->read && xfer->length==0)
+	{
+		xfer->status=I2C_XFER_ERROR;
+		return;
+	}
+	xfer->status=I2C_XFER_QUEUED;
+
+	primask=__get_PRIMASK();
+	__disable_irq();
+	if(bus->head==NULL)
+	{
+		bus->head=xfer;
+		bus->tail=xfer;
+		i2c_xfer_start(bus);
+	}
+	else
+	{
+		bus->tail->next=xfer;
+		bus->tail=xfer;
+	}
+	__set_PRIMASK(primask);
+}
+
+/* Retorna 1 se a fila do barramento esta vazia */
+int i2c_idle(const i2c_bus_t *bus)
+{
+	return bus->head==NULL;
+}
+
+/*
+ * Interrupcao de evento: a mesma sequencia das funcoes bloqueantes, um passo por flag. Com ITBUFEN as flags TXE/RXNE
+ * tambem geram interrupcao; ele so fica ligado enquanto ha bytes a mover, senao o TXE ficaria disparando sem parar.
+ * */
+static void i2c_ev(i2c_bus_t *bus)
+{
+	I2C_TypeDef *i2c=bus->regs;
+	i2c_xfer_t *x=bus->head;
+	uint32_t sr1=i2c->SR1;
+
+	if(x==NULL)
+	{
+		i2c->CR2&=~(I2C_CR2_ITEVTEN|I2C_CR2_ITERREN|I2C_CR2_ITBUFEN);
+		return;
+	}
+
+	if(sr1&I2C_SR1_SB)
+	{
+		if(bus->phase==PH_START && !(x->read && x->nreg==0))
+		{
+			i2c->DR=x->saddr<<1;
+			bus->phase=PH_ADDR_W;
+		}
+		else
+		{
+			// O ACK precisa estar certo antes de ADDR ser apagado
+			if(x->length==1)
+			{
+				i2c->CR1&=~I2C_CR1_ACK;
+			}
+			else
+			{
+				i2c->CR1|=I2C_CR1_ACK;
+			}
+			i2c->DR=x->saddr<<1|1;
+			bus->phase=PH_ADDR_R;
+		}
+		return;
+	}
+
+	if(sr1&I2C_SR1_ADDR)
+	{
+		if(bus->phase==PH_ADDR_R && x->length>=I2C_DMA_MIN)
+		{
+			/*
+			 * Leitura longa pelo DMA. Com LAST o periferico responde NACK sozinho no ultimo byte; o STOP e gerado na
+			 * interrupcao de fim do DMA. DMAEN e LAST precisam estar ligados antes de ADDR ser apagado.
+			 * */
+			bus->dma_rx->CMAR=(uint32_t)x->data;
+			bus->dma_rx->CNDTR=x->length;
+			bus->dma_rx->CCR|=DMA_CCR_EN;
+			i2c->CR2|=I2C_CR2_DMAEN|I2C_CR2_LAST;
+			(void)i2c->SR2;
+			bus->phase=PH_RX_DMA;
+			return;
+		}
+		(void)i2c->SR2;
+		if(bus->phase==PH_ADDR_R)
+		{
+			if(x->length==1)
+			{
+				i2c->CR1|=I2C_CR1_STOP;
+			}
+			bus->phase=PH_RX;
+		}
+		else
+		{
+			bus->phase=PH_TX;
+		}
+		bus->index=0;
+		i2c->CR2|=I2C_CR2_ITBUFEN;
+		return;
+	}
+
+	if(bus->phase==PH_TX)
+	{
+		uint16_t total=x->nreg+(x->read?0:x->length);
+		if(total==0)
+		{
+			// Apenas o endereco (teste de presenca)
+			i2c->CR1|=I2C_CR1_STOP;
+			i2c_xfer_finish(bus,I2C_XFER_DONE);
+		}
+		else if(bus->index<total)
+		{
+			if(!(sr1&I2C_SR1_TXE))
+			{
+				return;
+			}
+			if(bus->index==x->nreg && !x->read && x->length>=I2C_DMA_MIN)
+			{
+				// Dados longos: o DMA alimenta o DR e a interrupcao so volta no BTF do ultimo byte
+				bus->dma_tx->CMAR=(uint32_t)x->data;
+				bus->dma_tx->CNDTR=x->length;
+				bus->dma_tx->CCR|=DMA_CCR_EN;
+				i2c->CR2&=~I2C_CR2_ITBUFEN;
+				i2c->CR2|=I2C_CR2_DMAEN;
+				bus->index=total;
+			}
+			else
+			{
+				uint16_t i=bus->index++;
+				i2c->DR=(i<x->nreg)?(uint8_t)(x->reg>>(8*(x->nreg-1-i))):x->data[i-x->nreg];
+			}
+		}
+		else
+		{
+			// Tudo no DR: espera o ultimo byte sair (BTF) sem interrupcao de TXE
+			i2c->CR2&=~I2C_CR2_ITBUFEN;
+			if(sr1&I2C_SR1_BTF)
+			{
+				if(x->read)
+				{
+					i2c->CR1|=I2C_CR1_START;
+					bus->phase=PH_RESTART;
+				}
+				else
+				{
+					i2c->CR1|=I2C_CR1_STOP;
+					i2c_xfer_finish(bus,I2C_XFER_DONE);
+				}
+			}
+		}
+		return;
+	}
+
+	if(bus->phase==PH_RX && (sr1&I2C_SR1_RXNE))
+	{
+		x->data[bus->index++]=(uint8_t)i2c->DR;
+		uint16_t left=x->length-bus->index;
+		if(left==1)
+		{
+			// NACK e STOP valem para o byte que esta chegando agora, o ultimo
+			i2c->CR1&=~I2C_CR1_ACK;
+			i2c->CR1|=I2C_CR1_STOP;
+		}
+		else if(left==0)
+		{
+			i2c_xfer_finish(bus,I2C_XFER_DONE);
+		}
+	}
+}
+
+/* Interrupcao de erro: NACK, erro de barramento, perda de arbitragem ou overrun. A transferencia e descartada. */
+static void i2c_er(i2c_bus_t *bus)
+{
+	I2C_TypeDef *i2c=bus->regs;
+	uint32_t sr1=i2c->SR1;
+
+	i2c->SR1=(uint16_t)~(I2C_SR1_AF|I2C_SR1_BERR|I2C_SR1_ARLO|I2C_SR1_OVR|I2C_SR1_TIMEOUT);
+	if(!(sr1&I2C_SR1_ARLO))
+	{
+		// Com perda de arbitragem o periferico ja voltou a ser escravo e nao pode gerar STOP
+		i2c->CR1|=I2C_CR1_STOP;
+	}
+	if(bus->head!=NULL)
+	{
+		i2c_xfer_finish(bus,I2C_XFER_ERROR);
+	}
+}
+
+/* Fim da recepcao pelo DMA: o ultimo byte ja esta na memoria */
+static void i2c_dma_rx(i2c_bus_t *bus)
+{
+	DMA1->IFCR=bus->dma_rx_ifcr;
+	if(bus->head!=NULL && bus->phase==PH_RX_DMA)
+	{
+		bus->regs->CR1|=I2C_CR1_STOP;
+		i2c_xfer_finish(bus,I2C_XFER_DONE);
+	}
+}
+
+void I2C1_EV_IRQHandler(void)
+{
+	i2c_ev(&i2c_bus1);
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+	i2c_er(&i2c_bus1);
+}
+
+void DMA1_Channel7_IRQHandler(void)
+{
+	i2c_dma_rx(&i2c_bus1);
+}
+
+#if I2C_USE_I2C2
+void I2C2_EV_IRQHandler(void)
+{
+	i2c_ev(&i2c_bus2);
+}
+
+void I2C2_ER_IRQHandler(void)
+{
+	i2c_er(&i2c_bus2);
+}
+
+void DMA1_Channel5_IRQHandler(void)
+{
+	i2c_dma_rx(&i2c_bus2);
 }
+#endif
@@ -0,0 +1,255 @@
+#include "i2c_sched.h"
+#include "i2c.h"
+#include "timebase.h"
+#include "string.h"
+
+/*
+ * Escalonador de leituras I2C.
+ *
+ * Cada dispositivo registra um ou mais planos de leitura (i2c_job_t) com periodo e prioridade proprios. A cada chamada
+ * de i2c_sched_run() todos os planos vencidos sao executados um atras do outro, sem espera entre eles. Planos do mesmo
+ * dispositivo com registradores vizinhos sao unidos em uma unica leitura em rajada, ja que cada transacao extra custa
+ * START + endereco + registrador + START repetido + endereco (~5 bytes no barramento).
+ *
+ * Para nao deixar planos de baixa prioridade esperando para sempre quando o orcamento de tempo acaba, cada plano que
+ * venceu e ficou para depois ganha um ponto de "idade", que e descontado da sua prioridade na proxima escolha.
+ * */
+
+static i2c_job_t *jobs[I2C_SCHED_MAX_JOBS];
+static uint8_t job_count;
+static uint8_t burst[I2C_SCHED_MAX_BURST];
+
+static uint32_t last_run;
+static uint64_t busy_cycles;
+static uint64_t total_cycles;
+
+void i2c_sched_init(void)
+{
+	job_count=0;
+	i2c_sched_reset_stats();
+}
+
+/*
+ * Registra um plano de leitura. A primeira execucao acontece na proxima chamada de i2c_sched_run().
+ * Retorna 0 em caso de sucesso ou -1 se a tabela estiver cheia ou o plano for invalido.
+ * */
+int i2c_sched_add(i2c_job_t *job)
+{
+	if(job_count>=I2C_SCHED_MAX_JOBS || job->length==0 || job->data==NULL)
+	{
+		return -1;
+	}
+	job->due=timebase_cycles();
+	job->age=0;
+	job->pending=0;
+	job->runs=0;
+	job->overruns=0;
+	memset(job->hist,0,sizeof(job->hist));
+	jobs[job_count++]=job;
+	return 0;
+}
+
+void i2c_sched_reset_stats(void)
+{
+	last_run=timebase_cycles();
+	busy_cycles=0;
+	total_cycles=0;
+	for(uint8_t i=0;i<job_count;i++)
+	{
+		memset(jobs[i]->hist,0,sizeof(jobs[i]->hist));
+	}
+}
+
+/* Escolhe o plano pendente mais urgente: menor (prioridade - idade), desempate pelo vencimento mais antigo */
+static i2c_job_t *i2c_sched_pick(void)
+{
+	i2c_job_t *best=NULL;
+	int32_t best_prio=0;
+
+	for(uint8_t i=0;i<job_count;i++)
+	{
+		i2c_job_t *j=jobs[i];
+		if(!j->pending)
+		{
+			continue;
+		}
+		int32_t prio=(int32_t)j->priority-(int32_t)j->age;
+		if(best==NULL || prio<best_prio || (prio==best_prio && timebase_diff(j->due,best->due)<0))
+		{
+			best=j;
+			best_prio=prio;
+		}
+	}
+	return best;
+}
+
+static void i2c_sched_account(i2c_job_t *j, uint32_t now)
+{
+	uint32_t latency=(uint32_t)timebase_diff(now,j->due)/TIMEBASE_CYCLES_PER_US;
+	uint32_t bin=latency?(32U-__CLZ(latency)):0;
+	if(bin>=I2C_SCHED_HIST_BINS)
+	{
+		bin=I2C_SCHED_HIST_BINS-1;
+	}
+	if(j->hist[bin]<0xFFFF)
+	{
+		j->hist[bin]++;
+	}
+
+	j->runs++;
+	j->age=0;
+	j->pending=0;
+	j->due+=j->period_ms*TIMEBASE_CYCLES_PER_MS;
+	if(timebase_diff(now,j->due)>=0)
+	{
+		// Perdeu pelo menos um periodo inteiro: reagenda a partir de agora em vez de executar varias vezes seguidas
+		j->overruns++;
+		j->due=now+j->period_ms*TIMEBASE_CYCLES_PER_MS;
+	}
+	if(j->done)
+	{
+		j->done(j);
+	}
+}
+
+/*
+ * Executa os planos vencidos. budget_us limita o tempo gasto nesta chamada (0 = sem limite); os planos que nao
+ * couberem ficam pendentes e envelhecem. Retorna a quantidade de transacoes I2C realizadas.
+ * */
+uint32_t i2c_sched_run(uint32_t budget_us)
+{
+	uint32_t start=timebase_cycles();
+	uint32_t transactions=0;
+
+	total_cycles+=(uint32_t)(start-last_run);
+	last_run=start;
+
+	for(uint8_t i=0;i<job_count;i++)
+	{
+		if(timebase_diff(start,jobs[i]->due)>=0)
+		{
+			jobs[i]->pending=1;
+		}
+	}
+
+	i2c_job_t *lead;
+	while((lead=i2c_sched_pick())!=NULL)
+	{
+		if(budget_us && (timebase_cycles()-start)>=budget_us*TIMEBASE_CYCLES_PER_US)
+		{
+			break;
+		}
+
+		uint32_t t0=timebase_cycles();
+		if(lead->length>I2C_SCHED_MAX_BURST)
+		{
+			// Grande demais para o buffer de rajada: le direto no buffer do plano, sem agrupar
+			i2c1_readMemoryMulti(lead->saddr,lead->reg,lead->data,lead->length);
+			uint32_t t1=timebase_cycles();
+			busy_cycles+=(uint32_t)(t1-t0);
+			transactions++;
+			i2c_sched_account(lead,t1);
+			continue;
+		}
+
+		/* Janela [lo,hi) de registradores; cresce enquanto houver planos pendentes do mesmo dispositivo proximos */
+		uint32_t lo=lead->reg;
+		uint32_t hi=lead->reg+lead->length;
+		uint32_t members=0;
+		uint8_t grown=1;
+		for(uint8_t i=0;i<job_count;i++)
+		{
+			if(jobs[i]==lead)
+			{
+				members|=1UL<<i;
+			}
+		}
+		while(grown)
+		{
+			grown=0;
+			for(uint8_t i=0;i<job_count;i++)
+			{
+				i2c_job_t *j=jobs[i];
+				if((members&(1UL<<i)) || !j->pending || j->saddr!=lead->saddr)
+				{
+					continue;
+				}
+				uint32_t jlo=j->reg;
+				uint32_t jhi=j->reg+j->length;
+				uint32_t nlo=jlo<lo?jlo:lo;
+				uint32_t nhi=jhi>hi?jhi:hi;
+				if(jlo>hi+I2C_SCHED_MERGE_GAP || lo>jhi+I2C_SCHED_MERGE_GAP || (nhi-nlo)>I2C_SCHED_MAX_BURST)
+				{
+					continue;
+				}
+				lo=nlo;
+				hi=nhi;
+				members|=1UL<<i;
+				grown=1;
+			}
+		}
+
+		i2c1_readMemoryMulti(lead->saddr,(uint8_t)lo,burst,(uint8_t)(hi-lo));
+		uint32_t t1=timebase_cycles();
+		busy_cycles+=(uint32_t)(t1-t0);
+		transactions++;
+
+		for(uint8_t i=0;i<job_count;i++)
+		{
+			if(members&(1UL<<i))
+			{
+				memcpy(jobs[i]->data,&burst[jobs[i]->reg-lo],jobs[i]->length);
+				i2c_sched_account(jobs[i],t1);
+			}
+		}
+	}
+
+	for(uint8_t i=0;i<job_count;i++)
+	{
+		if(jobs[i]->pending && jobs[i]->age<0xFF)
+		{
+			jobs[i]->age++;
+		}
+	}
+	return transactions;
+}
+
+/* Ocupacao do barramento em permil (0..1000) desde o ultimo i2c_sched_reset_stats() */
+uint32_t i2c_sched_utilisation(void)
+{
+	uint64_t total=total_cycles+(uint32_t)(timebase_cycles()-last_run);
+	if(total==0)
+	{
+		return 0;
+	}
+	return (uint32_t)((busy_cycles*1000U)/total);
+}
+
+/*
+ * Percentil (1..100) da latencia do plano, do vencimento ate o fim da leitura, em us. O valor devolvido e o limite
+ * superior da faixa do histograma log2, ou seja, uma estimativa conservadora (no maximo 2x o valor real).
+ * */
+uint32_t i2c_sched_latency(const i2c_job_t *job, uint8_t percent)
+{
+	uint32_t total=0;
+	for(uint8_t b=0;b<I2C_SCHED_HIST_BINS;b++)
+	{
+		total+=job->hist[b];
+	}
+	if(total==0)
+	{
+		return 0;
+	}
+
+	uint32_t target=(total*percent+99U)/100U;
+	uint32_t count=0;
+	for(uint8_t b=0;b<I2C_SCHED_HIST_BINS;b++)
+	{
+		count+=job->hist[b];
+		if(count>=target)
+		{
+			return 1UL<<b;
+		}
+	}
+	return 1UL<<(I2C_SCHED_HIST_BINS-1);
+}
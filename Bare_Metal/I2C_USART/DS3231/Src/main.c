@@ -1,53 +1,154 @@
 #include "stm32f1xx.h"
 #include "i2c.h"
 #include "uart.h"
+#include "i2c_sched.h"
+#include "timebase.h"
+#include "ds3231.h"
+#include "timeconv.h"
+#include "eelog.h"
+#include "oled.h"
+#include "mpu6050.h"
+#include "bme280.h"
+#include "mempool.h"
+#include "stack.h"
 #include "stdio.h"
 #include "stdlib.h"
 
-uint8_t rtc_data[3];
-
 /* O DS3231 usa o formato BCD (Binary-Coded Decimal), que representa cada dígito decimal com 4 bits
- * (por exemplo, 25 é 0010 0101). Funções BCD são necessárias para converter os valores entre BCD e binário,
- * facilitando cálculos e exibições dos dados de tempo.
+ * (por exemplo, 25 é 0010 0101). A conversão para binário agora é feita dentro do driver (ds3231.c), que também
+ * mantém a hora atualizada pela interrupção de 1 Hz do pino SQW, sem ler o I2C a cada volta do laço.
  *
  * */
 
-int bcd_to_decimal(unsigned char x) {
-    return x - 6 * (x >> 4);
-}
-
-
-
 int main(void)
 {
 	uart2_init();
+	/* Sem heap (sysmem.c): com stdout sem buffer o printf() escreve direto e nunca chama malloc() */
+	setvbuf(stdout, NULL, _IONBF, 0);
+	/* A RAM livre foi pintada pelo startup; a cada minuto o pico de uso da pilha vai para a serial */
+	stack_init();
 	i2c_init();
+	timebase_init();
 	i2c1_scan_bus();
+	i2c_sched_init();
+	if (ds3231_init() < 0)
+	{
+		printf("DS3231 not found\r\n");
+	}
+	/* BME280 no I2C1: uma conversão forçada por segundo, lida pelo escalonador */
+	if (bme280_init(BME280_ADDR, 1000) < 0)
+	{
+		printf("BME280 not found\r\n");
+	}
+	bme280_data_t env;
+	/* A EEPROM AT24C32 do módulo guarda um registro por minuto, que sobrevive à falta de energia */
+	int records = eelog_init();
+	printf("EEPROM log: %d records, %u bytes free\r\n", records, eelog_free());
+	/* Display de status no I2C2 a 400 kHz, separado do barramento lento do RTC e da EEPROM */
+	i2c_bus_init(&i2c_bus2, I2C_SPEED_FAST);
+	int display = (oled_init(&i2c_bus2, OLED_SSD1306) == 0);
+	if (display)
+	{
+		/* A moldura ocupa a linha 0 e o texto é alinhado às páginas: o título vai na página 1, dentro dela, centrado */
+		oled_rect(0, 0, OLED_WIDTH, OLED_HEIGHT, 1);
+		oled_text((OLED_WIDTH - 6 * OLED_CHAR_W) / 2, 1, "DS3231");
+	}
+	/* IMU no mesmo barramento rápido, amostrando a 1 kHz e lido em lotes pelo FIFO */
+	int imu = (mpu6050_init(&i2c_bus2, 1000) == 0);
+	if (!imu)
+	{
+		printf("MPU-6050 not found\r\n");
+	}
+	mpu6050_sample_t sample = {0};
+	uint32_t samples = 0;
 	// Inicializa a semente do gerador de números aleatórios com valor fixo.
 	srand(1);
+	ds3231_time_t now;
+	uint8_t last_second = 0xFF;
+	char iso[TIME_ISO8601_LEN];
 	while(1)
 	{
-		/* Le os valores de horas, minutos e segundos do DS3231 (endereço 0x68), começando no registrador 0x00
-		 * e armazena esses valores em rtc_data. O valor 3 indica que três bytes (segundos, minutos e horas) são lidos.
-		 */
-		i2c1_readMemoryMulti((uint8_t)0x68,(uint8_t)0x00,rtc_data,(uint8_t)3);
-		for (uint8_t i=0;i<3;i++)
+		ds3231_service();
+		i2c_sched_run(0);
+		oled_flush();
+		while (mpu6050_read(&sample))
 		{
-			rtc_data[i]=bcd_to_decimal(rtc_data[i]);
+			samples++;
 		}
-		/* Criamos a função de escrita com multiplos que verifica se os segundos (rtc_data[0]) forem igual a 5, se for igual cria-se 			um array data_s postulando valores aleatórios para minutos e horas,
-		 * e escreve-se esses valores de volta ao DS3231 usando i2c1_writeMemoryMulti().
-		 * para ativa essa opção de escrita de mútiplos bytes basta descomentar o if abaixo.
+
+		/* Consulta o relógio de software: não gera nenhuma transação I2C */
+		ds3231_now(&now, NULL);
+		if (now.seconds == last_second)
+		{
+			continue;
+		}
+		last_second = now.seconds;
+
+		/* Exemplo de escrita: quando os segundos chegarem a 5, grava uma nova data/hora no DS3231 com
+		 * ds3231_set_time(), que escreve os 7 registradores numa única transação (i2c1_writeMemoryMulti()).
+		 * Para ativar essa opção basta descomentar o if abaixo.
 		 * */
 		/*
-		if(rtc_data[0]==5)
+		if(now.seconds==5)
 		{
-			uint8_t data_s[3]={0,rand()%20,rand()%10};
-			i2c1_writeMemoryMulti(0x68,0x00,data_s,3);
+			ds3231_time_t t = {.seconds = 0, .minutes = rand()%60, .hours = rand()%24,
+					.day = 1, .date = 1, .month = 1, .year = 2025};
+			ds3231_set_time(&t);
 		}
 		*/
 
-		printf("RTC time is: %d:%d:%d\r\n", rtc_data[2],rtc_data[1],rtc_data[0]);
-		for (int i=0;i<100000;i++);
+		/* Carimbo de tempo da telemetria: ISO 8601 e segundos desde 1970 (Unix epoch) */
+		time_format_iso8601(iso, &now);
+		printf("RTC time is: %s (epoch %lu)\r\n", iso, (unsigned long)time_to_epoch(&now));
+		if (imu)
+		{
+			printf("IMU: %lu samples, accel %d %d %d mg, gyro %d %d %d dps/10\r\n", (unsigned long)samples,
+					sample.accel[0], sample.accel[1], sample.accel[2], sample.gyro[0], sample.gyro[1], sample.gyro[2]);
+			samples = 0;
+		}
+		if (display)
+		{
+			/* Data na linha 2 e hora na linha 4; a cada segundo só os dígitos alterados vão para o display */
+			iso[10] = '\0';
+			iso[19] = '\0';
+			oled_text(34, 2, iso);
+			oled_text(40, 4, iso + 11);
+		}
+
+		/* Uma vez por minuto mostra a temperatura do sensor interno do DS3231 */
+		if (now.seconds == 0)
+		{
+			int16_t t = ds3231_temperature();
+			/* O sinal vai separado: entre -1 e 0 C a parte inteira é 0 e o "-" se perderia */
+			printf("RTC temperature: %s%d.%02d C\r\n", t < 0 ? "-" : "", abs(t) / 100, abs(t) % 100);
+			if (bme280_get(&env))
+			{
+				long centi = labs((long)env.temperature);
+				printf("BME280: %s%ld.%02ld C, %lu Pa, %lu %%RH\r\n", env.temperature < 0 ? "-" : "", centi / 100,
+						centi % 100, (unsigned long)(env.pressure >> 8), (unsigned long)(env.humidity >> 10));
+			}
+
+			uint8_t rec[6];
+			uint32_t epoch = (uint32_t)time_to_epoch(&now);
+			rec[0] = epoch; rec[1] = epoch >> 8; rec[2] = epoch >> 16; rec[3] = epoch >> 24;
+			rec[4] = t; rec[5] = t >> 8;
+			if (eelog_append(rec, sizeof(rec)) < 0)
+			{
+				printf("EEPROM log full\r\n");
+			}
+
+			/* Buffers de mensagem: uso, pico e pedidos recusados de cada classe */
+			for (uint8_t i = 0; i < MSG_POOLS; i++)
+			{
+				mempool_t *pool = msg_pool(i);
+				printf("Pool %s: %u/%u used, peak %u, %lu failed\r\n", pool->name, pool->used, pool->count,
+						pool->peak, (unsigned long)pool->failures);
+			}
+			if (sbrk_denied())
+			{
+				printf("Heap requests refused: %lu\r\n", (unsigned long)sbrk_denied());
+			}
+			stack_report();
+		}
 	}
 }
@@ -0,0 +1,153 @@
+#include "mempool.h"
+#include "stm32f1xx.h"
+
+/*
+ * Alocador de blocos fixos.
+ *
+ * Um bloco livre guarda no seu proprio primeiro word o ponteiro para o proximo, entao a lista livre nao custa RAM
+ * extra. Os blocos que nunca foram usados nao estao na lista: saem em ordem a partir do indice fresh. Assim o pool
+ * nao precisa de um laco de inicializacao e alloc/free sao O(1).
+ *
+ * Os buffers de mensagem somam 8x32 + 2x64 + 1x128 = 512 bytes, o mesmo que o _Min_Heap_Size reservava antes.
+ * */
+
+MEMPOOL_DEFINE(msg_small,MSG_POOL_SMALL_SIZE,MSG_POOL_SMALL_COUNT);
+MEMPOOL_DEFINE(msg_medium,MSG_POOL_MEDIUM_SIZE,MSG_POOL_MEDIUM_COUNT);
+MEMPOOL_DEFINE(msg_large,MSG_POOL_LARGE_SIZE,MSG_POOL_LARGE_COUNT);
+
+static mempool_t *const msg_pools[MSG_POOLS]={&msg_small,&msg_medium,&msg_large};
+
+/* Tira um bloco do pool sem contar a falta: quem chama decide se o pedido foi recusado */
+static void *mempool_take(mempool_t *pool)
+{
+	mempool_block_t *b=pool->free;
+
+	if(b!=NULL)
+	{
+		pool->free=b->next;
+	}
+	else if(pool->fresh<pool->count)
+	{
+		b=(mempool_block_t *)&pool->storage[pool->fresh*(pool->block_size/4U)];
+		pool->fresh++;
+	}
+	else
+	{
+		return NULL;
+	}
+
+	pool->allocs++;
+	pool->used++;
+	if(pool->used>pool->peak)
+	{
+		pool->peak=pool->used;
+	}
+	return b;
+}
+
+void *mempool_alloc(mempool_t *pool)
+{
+	void *b=mempool_take(pool);
+
+	if(b==NULL)
+	{
+		pool->failures++;
+	}
+	return b;
+}
+
+void mempool_free(mempool_t *pool, void *block)
+{
+	mempool_block_t *b=block;
+
+	if(b==NULL)
+	{
+		return;
+	}
+	b->next=pool->free;
+	pool->free=b;
+	pool->used--;
+}
+
+void *mempool_alloc_isr(mempool_t *pool)
+{
+	uint32_t primask=__get_PRIMASK();
+	__disable_irq();
+	void *b=mempool_alloc(pool);
+	__set_PRIMASK(primask);
+	return b;
+}
+
+void mempool_free_isr(mempool_t *pool, void *block)
+{
+	uint32_t primask=__get_PRIMASK();
+	__disable_irq();
+	mempool_free(pool,block);
+	__set_PRIMASK(primask);
+}
+
+/* 1 se block e o inicio de um bloco do pool */
+int mempool_owns(const mempool_t *pool, const void *block)
+{
+	uint32_t offset=(uint32_t)((const uint8_t *)block-(const uint8_t *)pool->storage);
+
+	return offset<(uint32_t)pool->block_size*pool->count && offset%pool->block_size==0;
+}
+
+/* Recomeca o pico a partir do uso atual e zera os contadores */
+void mempool_reset_stats(mempool_t *pool)
+{
+	uint32_t primask=__get_PRIMASK();
+	__disable_irq();
+	pool->peak=pool->used;
+	pool->allocs=0;
+	pool->failures=0;
+	__set_PRIMASK(primask);
+}
+
+/*
+ * Menor classe em que size cabe; se ela estiver esgotada tenta a seguinte, maior. Um pedido atendido por uma classe
+ * maior nao e falha: so quando todas estao esgotadas a falta e contada, uma vez, na menor classe que caberia.
+ * */
+void *msg_alloc(size_t size)
+{
+	mempool_t *first=NULL;
+	void *msg=NULL;
+	uint32_t primask=__get_PRIMASK();
+
+	__disable_irq();
+	for(uint8_t i=0;i<MSG_POOLS && msg==NULL;i++)
+	{
+		if(size<=msg_pools[i]->block_size)
+		{
+			if(first==NULL)
+			{
+				first=msg_pools[i];
+			}
+			msg=mempool_take(msg_pools[i]);
+		}
+	}
+	if(msg==NULL && first!=NULL)
+	{
+		first->failures++;
+	}
+	__set_PRIMASK(primask);
+	return msg;
+}
+
+void msg_free(void *msg)
+{
+	for(uint8_t i=0;i<MSG_POOLS;i++)
+	{
+		if(mempool_owns(msg_pools[i],msg))
+		{
+			mempool_free_isr(msg_pools[i],msg);
+			return;
+		}
+	}
+}
+
+mempool_t *msg_pool(uint8_t index)
+{
+	return index<MSG_POOLS?msg_pools[index]:NULL;
+}
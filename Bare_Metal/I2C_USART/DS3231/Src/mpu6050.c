@@ -0,0 +1,260 @@
+#include "mpu6050.h"
+#include "ds3231.h"
+#include "timebase.h"
+#include "stm32f1xx.h"
+
+/*
+ * IMU MPU-6050 lido em lotes pelo FIFO.
+ *
+ * O sensor amostra acelerometro e giroscopio na taxa programada (SMPLRT_DIV) e empilha cada amostra (12 bytes, big
+ * endian) no FIFO interno de 1 KB. O pino INT pulsa a cada amostra nova; a interrupcao do EXTI so guarda o instante
+ * e conta as bordas. A cada MPU6050_BATCH amostras ela dispara, pela fila assincrona do barramento, a mesma sequencia
+ * de leitura de bloco de i2c1_readMemoryMulti(): primeiro FIFO_COUNT (2 bytes) e, na callback, uma unica leitura de
+ * todas as amostras inteiras do FIFO_R_W, feita pelo DMA. A callback dessa leitura decodifica as amostras para ponto
+ * fixo e coloca na fila para o laco principal.
+ *
+ * A 1 kHz isso sao 1000 interrupcoes curtas de EXTI e 100 leituras de 122 bytes por segundo; a CPU nao participa da
+ * transferencia dos dados.
+ *
+ * O carimbo de tempo vem da ultima borda de INT antes da leitura do FIFO_COUNT: a ultima amostra do lote e a dessa
+ * borda e as anteriores ficam um periodo de amostragem atras cada uma. Uma borda que chegue entre a leitura do
+ * contador e a callback pode deslocar o lote em um periodo.
+ * */
+
+_Static_assert(MPU6050_INT_PIN!=DS3231_SQW_PIN,"MPU6050_INT_PIN e DS3231_SQW_PIN no mesmo EXTI");
+_Static_assert(!(I2C_PINS_USED&(1U<<MPU6050_INT_PIN)),"MPU6050_INT_PIN ocupado por um barramento I2C");
+
+#define MPU6050_SAMPLE_BYTES	12
+#define MPU6050_FIFO_SIZE		1024
+
+#define USER_CTRL_FIFO_EN		0x40
+#define USER_CTRL_FIFO_RESET	0x04
+
+static i2c_bus_t *imu_bus;
+static uint32_t period_cycles;
+
+static volatile uint32_t last_edge;
+static volatile uint8_t edges;
+static volatile uint8_t busy;
+static uint32_t batch_edge;
+
+static uint8_t count_buf[2];
+static uint8_t fifo_buf[MPU6050_MAX_BATCH*MPU6050_SAMPLE_BYTES];
+static uint8_t reset_cmd;
+static i2c_xfer_t count_xfer;
+static i2c_xfer_t fifo_xfer;
+static i2c_xfer_t reset_xfer;
+
+static mpu6050_sample_t ring[MPU6050_RING];
+static volatile uint16_t ring_head;
+static volatile uint16_t ring_tail;
+static volatile uint32_t batches;
+static volatile uint32_t dropped;
+
+static void mpu6050_fifo_done(i2c_xfer_t *xfer);
+
+static void mpu6050_write(uint8_t reg, uint8_t value)
+{
+	i2c_MemoryWrite_Byte(imu_bus,MPU6050_ADDR,reg,value);
+}
+
+static int16_t be16(const uint8_t *p)
+{
+	return (int16_t)((p[0]<<8)|p[1]);
+}
+
+static void mpu6050_release(i2c_xfer_t *xfer)
+{
+	busy=0;
+}
+
+/* FIFO_COUNT chegou: le de uma vez todas as amostras inteiras (ou esvazia o FIFO se ele transbordou) */
+static void mpu6050_count_done(i2c_xfer_t *xfer)
+{
+	if(xfer->status!=I2C_XFER_DONE)
+	{
+		busy=0;
+		return;
+	}
+
+	uint16_t count=(uint16_t)((count_buf[0]<<8)|count_buf[1]);
+	if(count>=MPU6050_FIFO_SIZE)
+	{
+		// Transbordou: o alinhamento das amostras se perdeu, o FIFO e zerado e religado
+		dropped+=MPU6050_FIFO_SIZE/MPU6050_SAMPLE_BYTES;
+		reset_cmd=USER_CTRL_FIFO_EN|USER_CTRL_FIFO_RESET;
+		reset_xfer.saddr=MPU6050_ADDR;
+		reset_xfer.nreg=1;
+		reset_xfer.reg=MPU6050_REG_USER_CTRL;
+		reset_xfer.read=0;
+		reset_xfer.data=&reset_cmd;
+		reset_xfer.length=1;
+		reset_xfer.done=mpu6050_release;
+		i2c_submit(imu_bus,&reset_xfer);
+		return;
+	}
+
+	uint16_t n=count/MPU6050_SAMPLE_BYTES;
+	if(n>MPU6050_MAX_BATCH)
+	{
+		n=MPU6050_MAX_BATCH;
+	}
+	if(n==0)
+	{
+		busy=0;
+		return;
+	}
+	batch_edge=last_edge;
+
+	fifo_xfer.saddr=MPU6050_ADDR;
+	fifo_xfer.nreg=1;
+	fifo_xfer.reg=MPU6050_REG_FIFO_R_W;
+	fifo_xfer.read=1;
+	fifo_xfer.data=fifo_buf;
+	fifo_xfer.length=n*MPU6050_SAMPLE_BYTES;
+	fifo_xfer.done=mpu6050_fifo_done;
+	i2c_submit(imu_bus,&fifo_xfer);
+}
+
+/*
+ * Decodifica o lote. Acelerometro a +/- 8 g: 4096 LSB/g, mg = raw*1000/4096 = raw*125/512. Giroscopio a
+ * +/- 2000 dps: 16,4 LSB/dps, decimos de dps = raw*10/16,4 = raw*25/41.
+ * */
+static void mpu6050_fifo_done(i2c_xfer_t *xfer)
+{
+	if(xfer->status==I2C_XFER_DONE)
+	{
+		uint16_t n=xfer->length/MPU6050_SAMPLE_BYTES;
+		const uint8_t *p=fifo_buf;
+		batches++;
+		for(uint16_t i=0;i<n;i++,p+=MPU6050_SAMPLE_BYTES)
+		{
+			uint16_t next=(ring_head+1)&(MPU6050_RING-1);
+			if(next==ring_tail)
+			{
+				dropped++;
+				continue;
+			}
+			mpu6050_sample_t *s=&ring[ring_head];
+			s->timestamp=batch_edge-(uint32_t)(n-1-i)*period_cycles;
+			for(uint8_t a=0;a<3;a++)
+			{
+				s->accel[a]=(int16_t)((be16(p+2*a)*125)>>9);
+				s->gyro[a]=(int16_t)((be16(p+6+2*a)*25)/41);
+			}
+			ring_head=next;
+		}
+	}
+	busy=0;
+}
+
+/* Configura PB1 como entrada flutuante (o INT do MPU-6050 e push-pull) e liga a borda de subida ao EXTI1 */
+static void mpu6050_exti_init(void)
+{
+	RCC->APB2ENR|=RCC_APB2ENR_IOPBEN|RCC_APB2ENR_AFIOEN;
+
+	GPIOB->CRL&=~(GPIO_CRL_MODE1|GPIO_CRL_CNF1);
+	GPIOB->CRL|=GPIO_CRL_CNF1_0;			// CNF1 = 01: entrada flutuante
+
+	AFIO->EXTICR[0]&=~AFIO_EXTICR1_EXTI1;
+	AFIO->EXTICR[0]|=AFIO_EXTICR1_EXTI1_PB;
+	EXTI->RTSR|=EXTI_RTSR_RT1;
+	EXTI->FTSR&=~EXTI_FTSR_FT1;
+	EXTI->PR=EXTI_PR_PR1;
+	EXTI->IMR|=EXTI_IMR_MR1;
+
+	NVIC_SetPriority(EXTI1_IRQn,1);
+	NVIC_EnableIRQ(EXTI1_IRQn);
+}
+
+/*
+ * Inicializa o sensor no barramento bus (de preferencia a 400 kHz: a 1 kHz sao ~12 kB/s so de dados) com a taxa de
+ * amostragem rate_hz (4 a 1000 Hz) e liga o FIFO e a interrupcao. A configuracao usa as funcoes bloqueantes; depois
+ * dela o barramento so deve receber transferencias pela fila. Requer timebase_init(). Retorna -1 se o sensor nao
+ * responder.
+ * */
+int mpu6050_init(i2c_bus_t *bus, uint16_t rate_hz)
+{
+	uint8_t who=0;
+
+	if(rate_hz<4 || rate_hz>1000)
+	{
+		return -1;
+	}
+	imu_bus=bus;
+	i2c_readMemoryByte(bus,MPU6050_ADDR,MPU6050_REG_WHO_AM_I,&who);
+	if(who!=0x68)
+	{
+		return -1;
+	}
+
+	mpu6050_write(MPU6050_REG_PWR_MGMT_1,0x80);			// reset
+	uint32_t t0=timebase_cycles();
+	while((timebase_cycles()-t0)<100*TIMEBASE_CYCLES_PER_MS){;}
+	mpu6050_write(MPU6050_REG_PWR_MGMT_1,0x01);			// acorda, clock do PLL do giroscopio X
+	mpu6050_write(MPU6050_REG_CONFIG,0x01);				// DLPF de 184 Hz: taxa interna de 1 kHz
+	mpu6050_write(MPU6050_REG_SMPLRT_DIV,(uint8_t)(1000/rate_hz-1));
+	mpu6050_write(MPU6050_REG_GYRO_CFG,0x18);			// +/- 2000 dps
+	mpu6050_write(MPU6050_REG_ACCEL_CFG,0x10);			// +/- 8 g
+	mpu6050_write(MPU6050_REG_INT_PIN_CFG,0x00);		// INT ativo em alto, push-pull, pulso de 50 us
+	mpu6050_write(MPU6050_REG_FIFO_EN,0x78);			// acelerometro + giroscopio X/Y/Z
+	mpu6050_write(MPU6050_REG_USER_CTRL,USER_CTRL_FIFO_RESET);
+	mpu6050_write(MPU6050_REG_USER_CTRL,USER_CTRL_FIFO_EN);
+
+	period_cycles=(1000U/rate_hz)*TIMEBASE_CYCLES_PER_MS;	// periodo real: SMPLRT_DIV+1 ms
+	ring_head=ring_tail=0;
+	edges=0;
+	busy=0;
+	count_xfer.saddr=MPU6050_ADDR;
+	count_xfer.nreg=1;
+	count_xfer.reg=MPU6050_REG_FIFO_COUNT;
+	count_xfer.read=1;
+	count_xfer.data=count_buf;
+	count_xfer.length=sizeof(count_buf);
+	count_xfer.done=mpu6050_count_done;
+
+	mpu6050_exti_init();
+	mpu6050_write(MPU6050_REG_INT_ENABLE,0x01);			// DATA_RDY_EN
+	return 0;
+}
+
+/* Retira a amostra mais antiga da fila. Retorna 1 se havia amostra, 0 se a fila estava vazia. */
+int mpu6050_read(mpu6050_sample_t *sample)
+{
+	if(ring_tail==ring_head)
+	{
+		return 0;
+	}
+	*sample=ring[ring_tail];
+	ring_tail=(ring_tail+1)&(MPU6050_RING-1);
+	return 1;
+}
+
+/* Quantidade de lotes lidos do FIFO */
+uint32_t mpu6050_batches(void)
+{
+	return batches;
+}
+
+/* Amostras perdidas por fila cheia ou por transbordamento do FIFO do sensor */
+uint32_t mpu6050_dropped(void)
+{
+	return dropped;
+}
+
+/* EXTI1: nova amostra no FIFO do sensor */
+void EXTI1_IRQHandler(void)
+{
+	last_edge=timebase_cycles();
+	EXTI->PR=EXTI_PR_PR1;
+	if(edges<0xFF)
+	{
+		edges++;
+	}
+	if(edges>=MPU6050_BATCH && !busy)
+	{
+		edges=0;
+		busy=1;
+		i2c_submit(imu_bus,&count_xfer);
+	}
+}
@@ -0,0 +1,420 @@
+#include "oled.h"
+#include "string.h"
+
+/*
+ * Display OLED 128x64 (SSD1306 ou SH1106) no I2C.
+ *
+ * A imagem fica em um framebuffer de 1 KB na mesma organizacao da RAM do controlador: 8 paginas de 128 bytes, cada
+ * byte e uma coluna de 8 pixels (bit 0 em cima). Os desenhos alteram apenas o framebuffer e anotam, por pagina, a
+ * faixa de colunas alteradas. oled_flush() envia somente essas faixas: para cada pagina suja uma transferencia de
+ * comando (pagina e coluna inicial) e uma de dados, colocadas na fila assincrona do barramento; os dados vao pelo
+ * DMA e a pagina seguinte e enfileirada pela callback da anterior, entao o laco principal nunca espera o I2C.
+ *
+ * Os dois controladores sao usados no modo de enderecamento por pagina (0xB0 | pagina, coluna em dois nibbles), o
+ * unico que o SH1106 tem; no SH1106 a coluna 0 da imagem e a coluna 2 da RAM.
+ *
+ * Uma atualizacao completa sao 1024 bytes de dados + 8 x 5 bytes de comando (~24 ms a 400 kHz). Uma atualizacao
+ * tipica de status (alguns digitos) e bem menor, porque oled_text() so marca as colunas que realmente mudaram.
+ * */
+
+/* Primeiro byte de cada escrita: Co = 0, D/C# = 0 (comandos) ou 1 (dados) */
+#define OLED_CTRL_CMD	0x00
+#define OLED_CTRL_DATA	0x40
+
+static uint8_t init_ssd1306[]=
+{
+	0xAE,			// display desligado
+	0xD5,0x80,		// divisor do clock
+	0xA8,0x3F,		// multiplex 64
+	0xD3,0x00,		// sem deslocamento vertical
+	0x40,			// linha inicial 0
+	0x8D,0x14,		// bomba de carga interna
+	0x20,0x02,		// enderecamento por pagina
+	0xA1,0xC8,		// espelha colunas e linhas (conector em cima)
+	0xDA,0x12,		// pinos COM alternados
+	0x81,0xCF,		// contraste
+	0xD9,0xF1,		// pre-carga
+	0xDB,0x40,		// VCOMH
+	0xA4,0xA6,		// mostra a RAM, sem inverter
+	0xAF			// display ligado
+};
+
+static uint8_t init_sh1106[]=
+{
+	0xAE,
+	0xD5,0x80,
+	0xA8,0x3F,
+	0xD3,0x00,
+	0x40,
+	0xAD,0x8B,		// conversor DC-DC ligado
+	0x32,			// tensao da bomba: 8,0 V
+	0xA1,0xC8,
+	0xDA,0x12,
+	0x81,0x80,
+	0xD9,0x22,
+	0xDB,0x35,
+	0xA4,0xA6,
+	0xAF
+};
+
+/* Fonte 5x7, ASCII 0x20-0x7E, uma coluna por byte (bit 0 em cima) */
+static const uint8_t font5x7[95*5]=
+{
+	0x00,0x00,0x00,0x00,0x00, 0x00,0x00,0x5F,0x00,0x00, 0x00,0x07,0x00,0x07,0x00, 0x14,0x7F,0x14,0x7F,0x14,	//  !"#
+	0x24,0x2A,0x7F,0x2A,0x12, 0x23,0x13,0x08,0x64,0x62, 0x36,0x49,0x55,0x22,0x50, 0x00,0x05,0x03,0x00,0x00,	// $%&'
+	0x00,0x1C,0x22,0x41,0x00, 0x00,0x41,0x22,0x1C,0x00, 0x08,0x2A,0x1C,0x2A,0x08, 0x08,0x08,0x3E,0x08,0x08,	// ()*+
+	0x00,0x50,0x30,0x00,0x00, 0x08,0x08,0x08,0x08,0x08, 0x00,0x60,0x60,0x00,0x00, 0x20,0x10,0x08,0x04,0x02,	// ,-./
+	0x3E,0x51,0x49,0x45,0x3E, 0x00,0x42,0x7F,0x40,0x00, 0x42,0x61,0x51,0x49,0x46, 0x21,0x41,0x45,0x4B,0x31,	// 0123
+	0x18,0x14,0x12,0x7F,0x10, 0x27,0x45,0x45,0x45,0x39, 0x3C,0x4A,0x49,0x49,0x30, 0x01,0x71,0x09,0x05,0x03,	// 4567
+	0x36,0x49,0x49,0x49,0x36, 0x06,0x49,0x49,0x29,0x1E, 0x00,0x36,0x36,0x00,0x00, 0x00,0x56,0x36,0x00,0x00,	// 89:;
+	0x08,0x14,0x22,0x41,0x00, 0x14,0x14,0x14,0x14,0x14, 0x00,0x41,0x22,0x14,0x08, 0x02,0x01,0x51,0x09,0x06,	// <=>?
+	0x32,0x49,0x79,0x41,0x3E, 0x7E,0x11,0x11,0x11,0x7E, 0x7F,0x49,0x49,0x49,0x36, 0x3E,0x41,0x41,0x41,0x22,	// @ABC
+	0x7F,0x41,0x41,0x22,0x1C, 0x7F,0x49,0x49,0x49,0x41, 0x7F,0x09,0x09,0x01,0x01, 0x3E,0x41,0x41,0x51,0x32,	// DEFG
+	0x7F,0x08,0x08,0x08,0x7F, 0x00,0x41,0x7F,0x41,0x00, 0x20,0x40,0x41,0x3F,0x01, 0x7F,0x08,0x14,0x22,0x41,	// HIJK
+	0x7F,0x40,0x40,0x40,0x40, 0x7F,0x02,0x04,0x02,0x7F, 0x7F,0x04,0x08,0x10,0x7F, 0x3E,0x41,0x41,0x41,0x3E,	// LMNO
+	0x7F,0x09,0x09,0x09,0x06, 0x3E,0x41,0x51,0x21,0x5E, 0x7F,0x09,0x19,0x29,0x46, 0x46,0x49,0x49,0x49,0x31,	// PQRS
+	0x01,0x01,0x7F,0x01,0x01, 0x3F,0x40,0x40,0x40,0x3F, 0x1F,0x20,0x40,0x20,0x1F, 0x7F,0x20,0x18,0x20,0x7F,	// TUVW
+	0x63,0x14,0x08,0x14,0x63, 0x03,0x04,0x78,0x04,0x03, 0x61,0x51,0x49,0x45,0x43, 0x00,0x7F,0x41,0x41,0x00,	// XYZ[
+	0x02,0x04,0x08,0x10,0x20, 0x00,0x41,0x41,0x7F,0x00, 0x04,0x02,0x01,0x02,0x04, 0x40,0x40,0x40,0x40,0x40,	// \]^_
+	0x00,0x01,0x02,0x04,0x00, 0x20,0x54,0x54,0x54,0x78, 0x7F,0x48,0x44,0x44,0x38, 0x38,0x44,0x44,0x44,0x20,	// `abc
+	0x38,0x44,0x44,0x48,0x7F, 0x38,0x54,0x54,0x54,0x18, 0x08,0x7E,0x09,0x01,0x02, 0x08,0x14,0x54,0x54,0x3C,	// defg
+	0x7F,0x08,0x04,0x04,0x78, 0x00,0x44,0x7D,0x40,0x00, 0x20,0x40,0x44,0x3D,0x00, 0x00,0x7F,0x10,0x28,0x44,	// hijk
+	0x00,0x41,0x7F,0x40,0x00, 0x7C,0x04,0x18,0x04,0x78, 0x7C,0x08,0x04,0x04,0x78, 0x38,0x44,0x44,0x44,0x38,	// lmno
+	0x7C,0x14,0x14,0x14,0x08, 0x08,0x14,0x14,0x18,0x7C, 0x7C,0x08,0x04,0x04,0x08, 0x48,0x54,0x54,0x54,0x20,	// pqrs
+	0x04,0x3F,0x44,0x40,0x20, 0x3C,0x40,0x40,0x20,0x7C, 0x1C,0x20,0x40,0x20,0x1C, 0x3C,0x40,0x30,0x40,0x3C,	// tuvw
+	0x44,0x28,0x10,0x28,0x44, 0x0C,0x50,0x50,0x50,0x3C, 0x44,0x64,0x54,0x4C,0x44, 0x00,0x08,0x36,0x41,0x00,	// xyz{
+	0x00,0x00,0x7F,0x00,0x00, 0x00,0x41,0x36,0x08,0x00, 0x08,0x04,0x08,0x10,0x08								// |}~
+};
+
+static uint8_t fb[OLED_PAGES][OLED_WIDTH];
+
+/* Faixa suja de cada pagina; lo > hi = pagina limpa */
+static uint8_t dirty_lo[OLED_PAGES];
+static uint8_t dirty_hi[OLED_PAGES];
+
+/* Faixas da atualizacao em andamento, copiadas de dirty_* por oled_flush() e usadas so pela callback */
+static uint8_t plan_lo[OLED_PAGES];
+static uint8_t plan_hi[OLED_PAGES];
+static uint8_t flush_page;
+static volatile uint8_t flushing;
+
+static i2c_bus_t *oled_bus;
+static uint8_t col_offset;
+static uint8_t cmd[3];
+static i2c_xfer_t cmd_xfer;
+static i2c_xfer_t data_xfer;
+
+static void oled_mark(uint8_t page, uint8_t lo, uint8_t hi)
+{
+	if(lo<dirty_lo[page])
+	{
+		dirty_lo[page]=lo;
+	}
+	if(hi>dirty_hi[page])
+	{
+		dirty_hi[page]=hi;
+	}
+}
+
+static void oled_next_page(void);
+
+static void oled_page_done(i2c_xfer_t *xfer)
+{
+	flush_page++;
+	oled_next_page();
+}
+
+/* Enfileira comando + dados da proxima pagina do plano; chamada por oled_flush() e, depois, pela callback */
+static void oled_next_page(void)
+{
+	while(flush_page<OLED_PAGES && plan_lo[flush_page]>plan_hi[flush_page])
+	{
+		flush_page++;
+	}
+	if(flush_page>=OLED_PAGES)
+	{
+		flushing=0;
+		return;
+	}
+
+	uint8_t lo=plan_lo[flush_page];
+	uint8_t col=lo+col_offset;
+	cmd[0]=0xB0|flush_page;
+	cmd[1]=col&0x0F;
+	cmd[2]=0x10|(col>>4);
+
+	cmd_xfer.saddr=OLED_ADDR;
+	cmd_xfer.nreg=1;
+	cmd_xfer.reg=OLED_CTRL_CMD;
+	cmd_xfer.read=0;
+	cmd_xfer.data=cmd;
+	cmd_xfer.length=sizeof(cmd);
+	cmd_xfer.done=NULL;
+
+	data_xfer.saddr=OLED_ADDR;
+	data_xfer.nreg=1;
+	data_xfer.reg=OLED_CTRL_DATA;
+	data_xfer.read=0;
+	data_xfer.data=&fb[flush_page][lo];
+	data_xfer.length=plan_hi[flush_page]-lo+1;
+	data_xfer.done=oled_page_done;
+
+	i2c_submit(oled_bus,&cmd_xfer);
+	i2c_submit(oled_bus,&data_xfer);
+}
+
+/*
+ * Inicializa o display no barramento bus (de preferencia a 400 kHz), limpa a tela e comeca a primeira atualizacao.
+ * A sequencia de inicializacao e enviada de forma bloqueante. Retorna -1 se o display nao responder.
+ * */
+int oled_init(i2c_bus_t *bus, uint8_t controller)
+{
+	if(i2c_probe(bus,OLED_ADDR)!=1)
+	{
+		return -1;
+	}
+	oled_bus=bus;
+	if(controller==OLED_SH1106)
+	{
+		col_offset=2;
+		i2c_writeMemoryMulti(bus,OLED_ADDR,OLED_CTRL_CMD,init_sh1106,sizeof(init_sh1106));
+	}
+	else
+	{
+		col_offset=0;
+		i2c_writeMemoryMulti(bus,OLED_ADDR,OLED_CTRL_CMD,init_ssd1306,sizeof(init_ssd1306));
+	}
+	flushing=0;
+	oled_clear();
+	oled_flush();
+	return 0;
+}
+
+/*
+ * Comeca a enviar as regioes alteradas desde a ultima chamada e retorna sem esperar. Se a atualizacao anterior ainda
+ * estiver em andamento nada e feito: as regioes continuam marcadas e saem na proxima chamada. Retorna a quantidade
+ * de bytes do framebuffer que serao enviados (0 se nada mudou ou se o display esta ocupado).
+ * */
+uint16_t oled_flush(void)
+{
+	uint16_t bytes=0;
+
+	if(oled_bus==NULL || flushing)
+	{
+		return 0;
+	}
+	for(uint8_t p=0;p<OLED_PAGES;p++)
+	{
+		plan_lo[p]=dirty_lo[p];
+		plan_hi[p]=dirty_hi[p];
+		if(plan_lo[p]<=plan_hi[p])
+		{
+			bytes+=plan_hi[p]-plan_lo[p]+1;
+		}
+		dirty_lo[p]=0xFF;
+		dirty_hi[p]=0;
+	}
+	if(bytes)
+	{
+		flushing=1;
+		flush_page=0;
+		oled_next_page();
+	}
+	return bytes;
+}
+
+int oled_busy(void)
+{
+	return flushing;
+}
+
+void oled_clear(void)
+{
+	memset(fb,0,sizeof(fb));
+	for(uint8_t p=0;p<OLED_PAGES;p++)
+	{
+		dirty_lo[p]=0;
+		dirty_hi[p]=OLED_WIDTH-1;
+	}
+}
+
+void oled_pixel(uint8_t x, uint8_t y, uint8_t on)
+{
+	if(x>=OLED_WIDTH || y>=OLED_HEIGHT)
+	{
+		return;
+	}
+	uint8_t mask=1U<<(y&7);
+	if(on)
+	{
+		fb[y>>3][x]|=mask;
+	}
+	else
+	{
+		fb[y>>3][x]&=~mask;
+	}
+	oled_mark(y>>3,x,x);
+}
+
+/*
+ * Preenche um retangulo trabalhando direto nas paginas: cada pagina recebe uma mascara calculada uma vez (inteira
+ * nas paginas do meio, parcial nas bordas), entao cada coluna custa um unico acesso por pagina em vez de 8 pixels.
+ * */
+void oled_fill_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t on)
+{
+	if(w==0 || h==0 || x>=OLED_WIDTH || y>=OLED_HEIGHT)
+	{
+		return;
+	}
+	uint8_t x1=(x+w>OLED_WIDTH)?OLED_WIDTH-1:x+w-1;
+	uint8_t y1=(y+h>OLED_HEIGHT)?OLED_HEIGHT-1:y+h-1;
+	uint8_t p0=y>>3;
+	uint8_t p1=y1>>3;
+
+	for(uint8_t p=p0;p<=p1;p++)
+	{
+		uint8_t mask=0xFF;
+		if(p==p0)
+		{
+			mask&=0xFF<<(y&7);
+		}
+		if(p==p1)
+		{
+			mask&=0xFF>>(7-(y1&7));
+		}
+		uint8_t *b=&fb[p][x];
+		for(uint8_t c=x;c<=x1;c++,b++)
+		{
+			if(on)
+			{
+				*b|=mask;
+			}
+			else
+			{
+				*b&=~mask;
+			}
+		}
+		oled_mark(p,x,x1);
+	}
+}
+
+void oled_hline(uint8_t x0, uint8_t x1, uint8_t y, uint8_t on)
+{
+	if(x0>x1)
+	{
+		uint8_t t=x0;
+		x0=x1;
+		x1=t;
+	}
+	oled_fill_rect(x0,y,x1-x0+1,1,on);
+}
+
+void oled_vline(uint8_t x, uint8_t y0, uint8_t y1, uint8_t on)
+{
+	if(y0>y1)
+	{
+		uint8_t t=y0;
+		y0=y1;
+		y1=t;
+	}
+	oled_fill_rect(x,y0,1,y1-y0+1,on);
+}
+
+/* Reta de Bresenham; horizontais e verticais usam o preenchimento por pagina */
+void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t on)
+{
+	if(y0==y1)
+	{
+		oled_hline(x0,x1,y0,on);
+		return;
+	}
+	if(x0==x1)
+	{
+		oled_vline(x0,y0,y1,on);
+		return;
+	}
+
+	int16_t dx=(x1>x0)?x1-x0:x0-x1;
+	int16_t dy=-((y1>y0)?y1-y0:y0-y1);
+	int8_t sx=(x0<x1)?1:-1;
+	int8_t sy=(y0<y1)?1:-1;
+	int16_t err=dx+dy;
+	int16_t x=x0;
+	int16_t y=y0;
+
+	while(1)
+	{
+		oled_pixel((uint8_t)x,(uint8_t)y,on);
+		if(x==x1 && y==y1)
+		{
+			break;
+		}
+		int16_t e2=2*err;
+		if(e2>=dy)
+		{
+			err+=dy;
+			x+=sx;
+		}
+		if(e2<=dx)
+		{
+			err+=dx;
+			y+=sy;
+		}
+	}
+}
+
+void oled_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t on)
+{
+	if(w==0 || h==0)
+	{
+		return;
+	}
+	oled_hline(x,x+w-1,y,on);
+	oled_hline(x,x+w-1,y+h-1,on);
+	oled_vline(x,y,y+h-1,on);
+	oled_vline(x+w-1,y,y+h-1,on);
+}
+
+/*
+ * Escreve str na pagina page (linha de texto 0-7) a partir da coluna x. Como o texto fica alinhado as paginas, cada
+ * caractere e uma copia de 6 bytes da fonte. So as colunas que mudaram sao marcadas para envio, entao reescrever
+ * "12:34:56" sobre "12:34:55" manda apenas o ultimo digito. Retorna a coluna seguinte ao texto.
+ * */
+uint8_t oled_text(uint8_t x, uint8_t page, const char *str)
+{
+	uint8_t lo=0xFF;
+	uint8_t hi=0;
+
+	if(page>=OLED_PAGES)
+	{
+		return x;
+	}
+	while(*str && x<=OLED_WIDTH-OLED_CHAR_W)
+	{
+		uint8_t c=(uint8_t)*str++;
+		uint8_t glyph[OLED_CHAR_W];
+		if(c<0x20 || c>0x7E)
+		{
+			c='?';
+		}
+		memcpy(glyph,&font5x7[(c-0x20)*5],5);
+		glyph[5]=0;
+
+		uint8_t *b=&fb[page][x];
+		if(memcmp(b,glyph,OLED_CHAR_W)!=0)
+		{
+			memcpy(b,glyph,OLED_CHAR_W);
+			if(lo==0xFF)
+			{
+				lo=x;
+			}
+			hi=x+OLED_CHAR_W-1;
+		}
+		x+=OLED_CHAR_W;
+	}
+	if(lo<=hi)
+	{
+		oled_mark(page,lo,hi);
+	}
+	return x;
+}
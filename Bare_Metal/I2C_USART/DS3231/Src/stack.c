@@ -0,0 +1,128 @@
+#include "stack.h"
+#include "stdio.h"
+
+/*
+ * Regioes de pilha acompanhadas.
+ *
+ * A pilha principal (MSP) e pintada pelo Reset_Handler de _end ate o SP inicial, ou seja, toda a RAM livre acima do
+ * .bss, e nao so a reserva de _Min_Stack_Size: se a pilha passar da reserva, o quanto ela passou ainda aparece.
+ * Pilhas de tarefas (quando houver um escalonador) sao pintadas por stack_register() antes de serem usadas.
+ *
+ * A procura comeca no fundo da reserva: enquanto a pilha nao a estourar, so os words da reserva sao lidos
+ * (no maximo 256 para 1 KB), e o laco e uma comparacao por word.
+ * */
+
+static stack_region_t regions[STACK_MAX_REGIONS];
+static uint8_t region_count;
+
+/* Primeiro word sem a pintura a partir de p, sem passar de top */
+static uint32_t *stack_scan(uint32_t *p, uint32_t *top)
+{
+	while(p<top && *p==STACK_PAINT)
+	{
+		p++;
+	}
+	return p;
+}
+
+/* Registra a pilha principal, ja pintada pelo startup */
+void stack_init(void)
+{
+	extern uint32_t _end[];				// Symbol defined in the linker script
+	extern uint32_t _estack[];			// Symbol defined in the linker script
+	extern uint8_t _Min_Stack_Size;		// Symbol defined in the linker script
+	stack_region_t *r=&regions[0];
+
+	r->name="main";
+	r->bottom=_end;
+	r->top=_estack;
+	r->limit=(uint32_t *)((uint32_t)_estack-(uint32_t)&_Min_Stack_Size);
+	r->peak=0;
+	region_count=1;
+}
+
+/*
+ * Pinta e registra a pilha de uma tarefa (base = menor endereco). A pilha ainda nao pode estar em uso.
+ * Retorna o indice da regiao ou -1 se a tabela estiver cheia.
+ * */
+int stack_register(const char *name, void *base, uint32_t size)
+{
+	if(region_count>=STACK_MAX_REGIONS)
+	{
+		return -1;
+	}
+
+	stack_region_t *r=&regions[region_count];
+	r->name=name;
+	r->bottom=(uint32_t *)(((uint32_t)base+3U)&~3UL);
+	r->top=(uint32_t *)(((uint32_t)base+size)&~3UL);
+	r->limit=r->bottom;
+	r->peak=0;
+	for(uint32_t *p=r->bottom;p<r->top;p++)
+	{
+		*p=STACK_PAINT;
+	}
+	return region_count++;
+}
+
+/* Bytes usados no ponto mais fundo que a pilha ja alcancou */
+uint32_t stack_high_water(uint8_t index)
+{
+	if(index>=region_count)
+	{
+		return 0;
+	}
+
+	stack_region_t *r=&regions[index];
+	uint32_t *p;
+	if(*r->limit==STACK_PAINT)
+	{
+		p=stack_scan(r->limit,r->top);
+	}
+	else
+	{
+		// A reserva foi estourada: procura a partir do fundo da area pintada
+		p=stack_scan(r->bottom,r->top);
+	}
+
+	uint32_t used=(uint32_t)((uint8_t *)r->top-(uint8_t *)p);
+	if(used>r->peak)
+	{
+		r->peak=used;
+	}
+	return r->peak;
+}
+
+/* 1 se a pilha ja passou do fundo da reserva (para tarefas: se apagou o ultimo word da propria pilha) */
+int stack_overflowed(uint8_t index)
+{
+	if(index>=region_count)
+	{
+		return 0;
+	}
+	return *regions[index].limit!=STACK_PAINT;
+}
+
+uint8_t stack_count(void)
+{
+	return region_count;
+}
+
+const stack_region_t *stack_region(uint8_t index)
+{
+	return index<region_count?&regions[index]:NULL;
+}
+
+/* Envia pelo printf (USART2) o pico de cada pilha e quanto sobra da reserva */
+void stack_report(void)
+{
+	for(uint8_t i=0;i<region_count;i++)
+	{
+		stack_region_t *r=&regions[i];
+		uint32_t used=stack_high_water(i);
+		uint32_t reserved=(uint32_t)((uint8_t *)r->top-(uint8_t *)r->limit);
+
+		printf("Stack %s: peak %lu of %lu bytes%s\r\n",r->name,(unsigned long)used,(unsigned long)reserved,
+				stack_overflowed(i)?" (OVERFLOW)":"");
+	}
+}
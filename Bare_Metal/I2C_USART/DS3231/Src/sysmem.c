@@ -1,58 +1,43 @@
-
 /* Includes */
 #include <errno.h>
 #include <stdint.h>
+#include <stddef.h>
 
 /**
- * Pointer to the current high watermark of the heap usage
+ * Number of refused heap requests
  */
-static uint8_t *__sbrk_heap_end = NULL;
+static uint32_t __sbrk_denied = 0;
 
 /**
- * @brief _sbrk() allocates memory to the newlib heap and is used by malloc
+ * @brief _sbrk() would allocate memory to the newlib heap, used by malloc
  *        and others from the C library
  *
  * @verbatim
  * ############################################################################
- * #  .data  #  .bss  #       newlib heap       #          MSP stack          #
- * #         #        #                         # Reserved by _Min_Stack_Size #
+ * #  .data  #  .bss  #  (no heap)  #             MSP stack                   #
+ * #         #        #             #     Reserved by _Min_Stack_Size         #
  * ############################################################################
  * ^-- RAM start      ^-- _end                             _estack, RAM end --^
  * @endverbatim
  *
- * This implementation starts allocating at the '_end' linker symbol
- * The '_Min_Stack_Size' linker symbol reserves a memory for the MSP stack
- * The implementation considers '_estack' linker symbol to be RAM end
- * NOTE: If the MSP stack, at any point during execution, grows larger than the
- * reserved size, please increase the '_Min_Stack_Size'.
+ * The heap is disabled (_Min_Heap_Size = 0): dynamic memory comes from the
+ * fixed-block pools in mempool.c, whose timing does not depend on history.
+ * Every request fails with ENOMEM, so malloc() returns NULL, and is counted;
+ * sbrk_denied() != 0 means some library call is still trying to use the heap.
+ * stdout is made unbuffered in main() so printf() never asks for a buffer.
  *
  * @param incr Memory size
- * @return Pointer to allocated memory
+ * @return (void *)-1
  */
 void *_sbrk(ptrdiff_t incr)
 {
-  extern uint8_t _end; /* Symbol defined in the linker script */
-  extern uint8_t _estack; /* Symbol defined in the linker script */
-  extern uint32_t _Min_Stack_Size; /* Symbol defined in the linker script */
-  const uint32_t stack_limit = (uint32_t)&_estack - (uint32_t)&_Min_Stack_Size;
-  const uint8_t *max_heap = (uint8_t *)stack_limit;
-  uint8_t *prev_heap_end;
-
-  /* Initialize heap end at first call */
-  if (NULL == __sbrk_heap_end)
-  {
-    __sbrk_heap_end = &_end;
-  }
-
-  /* Protect heap from growing into the reserved MSP stack */
-  if (__sbrk_heap_end + incr > max_heap)
-  {
-    errno = ENOMEM;
-    return (void *)-1;
-  }
-
-  prev_heap_end = __sbrk_heap_end;
-  __sbrk_heap_end += incr;
+  (void)incr;
+  __sbrk_denied++;
+  errno = ENOMEM;
+  return (void *)-1;
+}
 
-  return (void *)prev_heap_end;
+uint32_t sbrk_denied(void)
+{
+  return __sbrk_denied;
 }
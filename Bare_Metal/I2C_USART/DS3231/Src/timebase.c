@@ -0,0 +1,13 @@
+#include "timebase.h"
+
+/*
+ * Habilita o contador de ciclos do DWT (Data Watchpoint and Trace). O Cortex-M3 conta um ciclo por clock do nucleo
+ * sem custo nenhum de CPU, o que da uma base de tempo de 125 ns a 8 MHz para medir latencias e agendar tarefas.
+ * O bloco DWT so funciona com o bit TRCENA do DEMCR ligado.
+ * */
+void timebase_init(void)
+{
+	CoreDebug->DEMCR|=CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT=0;
+	DWT->CTRL|=DWT_CTRL_CYCCNTENA_Msk;
+}
@@ -0,0 +1,142 @@
+#include "timeconv.h"
+#include "string.h"
+
+/*
+ * Conversoes de tempo para os registros de telemetria.
+ *
+ * Todas as rotinas usam apenas aritmetica inteira de 32 bits (a multiplicacao de 64 bits de time_to_epoch() vira um
+ * unico UMULL) e nenhuma divisao por variavel: as divisoes por constantes sao trocadas pelo compilador por
+ * multiplicacoes. Nao ha laços dependentes do valor da data, entao o tempo de execucao e fixo.
+ *
+ * O calendario e o gregoriano proleptico, com os algoritmos days_from_civil/civil_from_days de Howard Hinnant
+ * (http://howardhinnant.github.io/date_algorithms.html), que contam o ano a partir de marco para que o dia 29 de
+ * fevereiro fique no fim do "ano" e nao precise de tratamento especial.
+ *
+ * O dia da semana segue a ISO 8601: 1 = segunda-feira ... 7 = domingo.
+ * */
+
+/* Dias entre 0000-03-01 (origem dos eras de 400 anos) e 1970-01-01 */
+#define DAYS_0000_03_01_TO_EPOCH	719468
+#define DAYS_PER_ERA				146097
+
+/*
+ * Converte um bloco de n bytes BCD para binario. Quatro bytes sao convertidos de uma vez com a mesma conta de
+ * bcd_to_bin() feita em paralelo nos quatro bytes da palavra (o resultado de cada byte nunca empresta do vizinho).
+ * dst pode ser igual a src.
+ * */
+void bcd_unpack_block(uint8_t *dst, const uint8_t *src, uint32_t n)
+{
+	uint32_t w;
+
+	while(n>=4)
+	{
+		memcpy(&w,src,4);
+		w-=6*((w>>4)&0x0F0F0F0FUL);
+		memcpy(dst,&w,4);
+		src+=4;
+		dst+=4;
+		n-=4;
+	}
+	while(n--)
+	{
+		*dst++=bcd_to_bin(*src++);
+	}
+}
+
+/* Converte um bloco de n bytes binarios (0-99) para BCD. dst pode ser igual a src. */
+void bcd_pack_block(uint8_t *dst, const uint8_t *src, uint32_t n)
+{
+	while(n--)
+	{
+		*dst++=bin_to_bcd(*src++);
+	}
+}
+
+/* Dias desde 1970-01-01 (negativo antes disso) para uma data do calendario gregoriano */
+int32_t days_from_civil(uint32_t year, uint32_t month, uint32_t day)
+{
+	year-=(month<=2);
+	uint32_t era=year/400;
+	uint32_t yoe=year-era*400;									// [0, 399]
+	uint32_t doy=(153*(month+(month>2?-3:9))+2)/5+day-1;		// [0, 365]
+	uint32_t doe=yoe*365+yoe/4-yoe/100+doy;						// [0, 146096]
+	return (int32_t)(era*DAYS_PER_ERA+doe)-DAYS_0000_03_01_TO_EPOCH;
+}
+
+/* Operacao inversa de days_from_civil(), valida para datas a partir de 0000-03-01 */
+void civil_from_days(int32_t days, uint16_t *year, uint8_t *month, uint8_t *day)
+{
+	uint32_t z=(uint32_t)(days+DAYS_0000_03_01_TO_EPOCH);
+	uint32_t era=z/DAYS_PER_ERA;
+	uint32_t doe=z-era*DAYS_PER_ERA;								// [0, 146096]
+	uint32_t yoe=(doe-doe/1460+doe/36524-doe/146096)/365;		// [0, 399]
+	uint32_t doy=doe-(365*yoe+yoe/4-yoe/100);					// [0, 365]
+	uint32_t mp=(5*doy+2)/153;									// [0, 11], 0 = marco
+	uint32_t m=mp<10?mp+3:mp-9;
+
+	*day=(uint8_t)(doy-(153*mp+2)/5+1);
+	*month=(uint8_t)m;
+	*year=(uint16_t)(yoe+era*400+(m<=2));
+}
+
+/* Segundos desde 1970-01-01 00:00:00 UTC. Usa 64 bits porque o DS3231 vai ate 2199 (32 bits estouram em 2106). */
+uint64_t time_to_epoch(const ds3231_time_t *time)
+{
+	uint32_t days=(uint32_t)days_from_civil(time->year,time->month,time->date);
+	uint32_t sod=time->hours*3600U+time->minutes*60U+time->seconds;
+	return (uint64_t)days*86400U+sod;
+}
+
+/*
+ * Operacao inversa de time_to_epoch(). 86400 = 128*675, entao epoch/86400 = (epoch>>7)/675: a divisao de 64 bits
+ * (rotina de biblioteca, lenta no M3) vira um deslocamento e uma divisao de 32 bits por constante.
+ * */
+void epoch_to_time(uint64_t epoch, ds3231_time_t *time)
+{
+	uint32_t days=(uint32_t)(epoch>>7)/675U;
+	uint32_t sod=(uint32_t)(epoch-(uint64_t)days*86400U);
+	uint32_t hours=sod/3600U;
+	uint32_t rem=sod-hours*3600U;
+	uint32_t minutes=rem/60U;
+
+	time->hours=(uint8_t)hours;
+	time->minutes=(uint8_t)minutes;
+	time->seconds=(uint8_t)(rem-minutes*60U);
+	time->day=(uint8_t)((days+3)%7+1);							// 1970-01-01 foi uma quinta-feira
+	civil_from_days((int32_t)days,&time->year,&time->month,&time->date);
+}
+
+/* Escreve os dois digitos decimais de v (0-99) */
+static char *put2(char *p, uint32_t v)
+{
+	uint32_t tens=(v*205U)>>11;
+	p[0]=(char)('0'+tens);
+	p[1]=(char)('0'+v-tens*10);
+	return p+2;
+}
+
+/*
+ * Formata a hora como ISO 8601 em UTC ("2025-01-31T23:59:59Z") sem printf. buf precisa de TIME_ISO8601_LEN bytes.
+ * Retorna o comprimento do texto (sem o '\0').
+ * */
+uint8_t time_format_iso8601(char *buf, const ds3231_time_t *time)
+{
+	uint32_t century=((uint32_t)time->year*1311U)>>17;			// year/100 para year < 4096
+	char *p=buf;
+
+	p=put2(p,century);
+	p=put2(p,time->year-century*100);
+	*p++='-';
+	p=put2(p,time->month);
+	*p++='-';
+	p=put2(p,time->date);
+	*p++='T';
+	p=put2(p,time->hours);
+	*p++=':';
+	p=put2(p,time->minutes);
+	*p++=':';
+	p=put2(p,time->seconds);
+	*p++='Z';
+	*p='\0';
+	return (uint8_t)(p-buf);
+}
@@ -91,6 +91,20 @@ LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
 
+/* Paint the free RAM from _end up to the stack pointer with STACK_PAINT (stack.h); stack.c later looks for the
+   deepest word the stack has overwritten. */
+  ldr r2, =_end
+  mov r4, sp
+  ldr r3, =0xDEADBEEF
+  b LoopPaintStack
+
+PaintStack:
+  str r3, [r2], #4
+
+LoopPaintStack:
+  cmp r2, r4
+  bcc PaintStack
+
 /* Call static constructors */
   bl __libc_init_array
 /* Call the application's entry point.*/
@@ -0,0 +1,15 @@
+#include "stm32f1xx.h"
+
+/* Registradores de mentira declarados em stm32f1xx.h (substituto para os testes no PC) */
+
+I2C_TypeDef sim_i2c1,sim_i2c2;
+DMA_Channel_TypeDef sim_dma1[7];
+DWT_Type sim_dwt;
+RCC_TypeDef sim_rcc;
+GPIO_TypeDef sim_gpiob;
+AFIO_TypeDef sim_afio;
+EXTI_TypeDef sim_exti;
+
+uint32_t sim_dwt_step;
+uint32_t sim_primask;
+uint8_t sim_irq_enabled[SIM_IRQ_COUNT];
@@ -0,0 +1,163 @@
+#ifndef STM32F1XX_H
+#define STM32F1XX_H
+
+/*
+ * Substituto do cabecalho do dispositivo para os testes no PC. Os drivers sao compilados sem alteracao contra estes
+ * registradores de mentira (variaveis comuns em sim_stm32.c); os testes colocam este diretorio antes de Inc/ no
+ * caminho de includes.
+ *
+ * So existe o que os drivers testados usam. As funcoes do nucleo (interrupcoes, barreiras) nao fazem nada, a nao ser
+ * registrar o estado de PRIMASK e das interrupcoes do NVIC para os testes conferirem. O contador de ciclos so anda
+ * quando o teste manda, ou sim_dwt_step ciclos por acesso, para que os lacos de espera dos drivers terminem.
+ * */
+
+#include "stdint.h"
+
+typedef enum
+{
+	EXTI0_IRQn=6,
+	EXTI1_IRQn=7,
+	DMA1_Channel4_IRQn=14,
+	DMA1_Channel5_IRQn=15,
+	DMA1_Channel6_IRQn=16,
+	DMA1_Channel7_IRQn=17,
+	I2C1_EV_IRQn=31,
+	I2C1_ER_IRQn=32,
+	I2C2_EV_IRQn=33,
+	I2C2_ER_IRQn=34,
+	SIM_IRQ_COUNT=43
+} IRQn_Type;
+
+typedef struct
+{
+	volatile uint32_t CR1,CR2,OAR1,OAR2,DR,SR1,SR2,CCR,TRISE;
+} I2C_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t CCR,CNDTR,CPAR,CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t CTRL,CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+	volatile uint32_t AHBENR,APB2ENR,APB1ENR;
+} RCC_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t CRL,CRH,IDR,ODR,BSRR,BRR,LCKR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t EVCR,MAPR,EXTICR[4];
+} AFIO_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t IMR,EMR,RTSR,FTSR,SWIER,PR;
+} EXTI_TypeDef;
+
+extern I2C_TypeDef sim_i2c1,sim_i2c2;
+extern DMA_Channel_TypeDef sim_dma1[7];
+extern DWT_Type sim_dwt;
+extern RCC_TypeDef sim_rcc;
+extern GPIO_TypeDef sim_gpiob;
+extern AFIO_TypeDef sim_afio;
+extern EXTI_TypeDef sim_exti;
+
+extern uint32_t sim_dwt_step;			// ciclos que o DWT->CYCCNT avanca a cada acesso (para lacos de espera)
+extern uint32_t sim_primask;			// 1 entre __disable_irq() e __enable_irq()
+extern uint8_t sim_irq_enabled[SIM_IRQ_COUNT];
+
+#define I2C1				(&sim_i2c1)
+#define I2C2				(&sim_i2c2)
+#define DMA1_Channel4		(&sim_dma1[3])
+#define DMA1_Channel5		(&sim_dma1[4])
+#define DMA1_Channel6		(&sim_dma1[5])
+#define DMA1_Channel7		(&sim_dma1[6])
+#define DWT					(sim_dwt_access())
+#define RCC					(&sim_rcc)
+#define GPIOB				(&sim_gpiob)
+#define AFIO				(&sim_afio)
+#define EXTI				(&sim_exti)
+
+#define RCC_APB2ENR_AFIOEN			(1U<<0)
+#define RCC_APB2ENR_IOPBEN			(1U<<3)
+
+#define GPIO_CRL_MODE0				(3U<<0)
+#define GPIO_CRL_CNF0				(3U<<2)
+#define GPIO_CRL_CNF0_0				(1U<<2)
+#define GPIO_CRL_CNF0_1				(2U<<2)
+#define GPIO_CRL_MODE1				(3U<<4)
+#define GPIO_CRL_CNF1				(3U<<6)
+#define GPIO_CRL_CNF1_0				(1U<<6)
+#define GPIO_CRL_CNF1_1				(2U<<6)
+
+#define AFIO_EXTICR1_EXTI0			(0xFU<<0)
+#define AFIO_EXTICR1_EXTI0_PB		(1U<<0)
+#define AFIO_EXTICR1_EXTI1			(0xFU<<4)
+#define AFIO_EXTICR1_EXTI1_PB		(1U<<4)
+
+#define EXTI_IMR_MR0				(1U<<0)
+#define EXTI_IMR_MR1				(1U<<1)
+#define EXTI_RTSR_RT0				(1U<<0)
+#define EXTI_RTSR_RT1				(1U<<1)
+#define EXTI_FTSR_FT0				(1U<<0)
+#define EXTI_FTSR_FT1				(1U<<1)
+#define EXTI_PR_PR0					(1U<<0)
+#define EXTI_PR_PR1					(1U<<1)
+
+static inline DWT_Type *sim_dwt_access(void)
+{
+	sim_dwt.CYCCNT+=sim_dwt_step;
+	return &sim_dwt;
+}
+
+static inline void __disable_irq(void)
+{
+	sim_primask=1;
+}
+
+static inline void __enable_irq(void)
+{
+	sim_primask=0;
+}
+
+static inline uint32_t __get_PRIMASK(void)
+{
+	return sim_primask;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+	sim_primask=primask&1U;
+}
+
+static inline void __DMB(void)
+{
+	__asm__ volatile("" ::: "memory");
+}
+
+static inline void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+	(void)irq;
+	(void)priority;
+}
+
+static inline void NVIC_EnableIRQ(IRQn_Type irq)
+{
+	sim_irq_enabled[irq]=1;
+}
+
+static inline void NVIC_DisableIRQ(IRQn_Type irq)
+{
+	sim_irq_enabled[irq]=0;
+}
+
+#endif /* STM32F1XX_H */
@@ -0,0 +1,334 @@
+/*
+ * Teste do driver do DS3231 (Src/ds3231.c) no PC, contra um DS3231 simulado.
+ *
+ * As funcoes bloqueantes do I2C sao trocadas por um chip de 19 registradores com o comportamento do datasheet
+ * (ponteiro de registrador que avanca e volta a 0x00 depois de 0x12, flags A1F/A2F/OSF que so aceitam escrita de 0,
+ * BSY somente leitura). Cada chamada conta como uma transacao, para conferir que o driver agrupa os acessos.
+ * A borda de 1 Hz e simulada chamando EXTI0_IRQHandler() depois de avancar o DWT->CYCCNT de mentira.
+ *
+ * Compilar:  gcc -O2 -Wall -Wextra -Wno-unused-parameter -I. -I../Inc -o test_ds3231 test_ds3231.c sim_stm32.c ../Src/ds3231.c ../Src/timeconv.c
+ * Uso:       ./test_ds3231   (retorna 0 se todos os testes passaram)
+ * */
+
+#include <stdio.h>
+#include <string.h>
+#include "ds3231.h"
+#include "i2c.h"
+#include "timebase.h"
+#include "timeconv.h"
+
+void EXTI0_IRQHandler(void);
+
+static int failures;
+
+#define CHECK(cond)		check((cond),#cond,__LINE__)
+
+static void check(int ok, const char *what, int line)
+{
+	if(!ok)
+	{
+		printf("FALHOU linha %d: %s\n",line,what);
+		failures++;
+	}
+}
+
+/* ---------- DS3231 simulado ---------- */
+
+static uint8_t chip[DS3231_NUM_REGS];
+static uint32_t reads;
+static uint32_t writes;
+static uint8_t last_reg;				// primeiro registrador e tamanho da ultima escrita
+static uint8_t last_len;
+
+i2c_bus_t i2c_bus1;
+
+static void chip_write(uint8_t reg, uint8_t value)
+{
+	if(reg==DS3231_REG_STATUS)
+	{
+		// A1F, A2F e OSF so podem ser apagados; BSY e somente leitura
+		uint8_t sticky=DS3231_STAT_A1F|DS3231_STAT_A2F|DS3231_STAT_OSF;
+		value=(chip[reg]&sticky&value)|(value&DS3231_STAT_EN32KHZ)|(chip[reg]&DS3231_STAT_BSY);
+	}
+	if(reg<DS3231_REG_TEMP_MSB)
+	{
+		chip[reg]=value;
+	}
+}
+
+int i2c_probe(i2c_bus_t *bus, uint8_t saddr)
+{
+	return bus==&i2c_bus1 && saddr==DS3231_ADDR;
+}
+
+void i2c_readMemoryMulti(i2c_bus_t *bus, uint8_t saddr, uint8_t maddr, uint8_t *data, uint8_t length)
+{
+	reads++;
+	while(length--)
+	{
+		*data++=chip[maddr];
+		maddr=(maddr+1)%DS3231_NUM_REGS;
+	}
+}
+
+void i2c_readMemoryByte(i2c_bus_t *bus, uint8_t saddr, uint8_t maddr, uint8_t *data)
+{
+	i2c_readMemoryMulti(bus,saddr,maddr,data,1);
+}
+
+void i2c_writeMemoryMulti(i2c_bus_t *bus, uint8_t saddr, uint8_t maddr, uint8_t *data, uint8_t length)
+{
+	writes++;
+	last_reg=maddr;
+	last_len=length;
+	while(length--)
+	{
+		chip_write(maddr,*data++);
+		maddr=(maddr+1)%DS3231_NUM_REGS;
+	}
+}
+
+void i2c_MemoryWrite_Byte(i2c_bus_t *bus, uint8_t saddr, uint8_t maddr, uint8_t data)
+{
+	i2c_writeMemoryMulti(bus,saddr,maddr,&data,1);
+}
+
+static void chip_set_time(uint16_t year, uint8_t month, uint8_t date, uint8_t day, uint8_t h, uint8_t m, uint8_t s)
+{
+	uint8_t v[7]={s,m,h,day,date,month,(uint8_t)(year%100)};
+	bcd_pack_block(chip,v,7);
+	chip[5]|=(year>=2100)?0x80:0;
+}
+
+/* Borda de descida do SQW, um segundo (ou cycles) depois da anterior */
+static void sqw_edge(uint32_t cycles)
+{
+	DWT->CYCCNT+=cycles;
+	EXTI0_IRQHandler();
+}
+
+static int same_time(const ds3231_time_t *a, uint16_t year, uint8_t month, uint8_t date, uint8_t h, uint8_t m, uint8_t s)
+{
+	return a->year==year && a->month==month && a->date==date && a->hours==h && a->minutes==m && a->seconds==s;
+}
+
+/* ---------- testes ---------- */
+
+static void test_init(void)
+{
+	ds3231_time_t t;
+	uint32_t us;
+
+	chip[DS3231_REG_CONTROL]=DS3231_CTRL_INTCN|DS3231_CTRL_RS1|DS3231_CTRL_RS2;	// valor de fabrica
+	chip_set_time(2099,12,31,4,23,59,58);
+	DWT->CYCCNT=0xFFFF0000UL;					// estoura durante o teste
+
+	CHECK(ds3231_init()==0);
+	CHECK(reads==1);							// os 19 registradores numa rajada
+	CHECK(writes==1 && last_reg==DS3231_REG_CONTROL && last_len==1);
+	CHECK((chip[DS3231_REG_CONTROL]&(DS3231_CTRL_INTCN|DS3231_CTRL_RS1|DS3231_CTRL_RS2))==0);
+	CHECK((EXTI->IMR&EXTI_IMR_MR0) && (EXTI->FTSR&EXTI_FTSR_FT0) && sim_irq_enabled[EXTI0_IRQn]);
+
+	DWT->CYCCNT+=TIMEBASE_CPU_HZ/4;
+	ds3231_now(&t,&us);
+	CHECK(same_time(&t,2099,12,31,23,59,58));
+	CHECK(us==250000);
+}
+
+/* Bordas de 1 Hz: o relogio anda sem I2C ate a virada do dia, que faz uma unica releitura */
+static void test_edges(void)
+{
+	ds3231_time_t t;
+	uint32_t r=reads;
+
+	sqw_edge(TIMEBASE_CPU_HZ-TIMEBASE_CPU_HZ/4);	// 1 s depois da leitura de ds3231_init()
+	ds3231_service();
+	ds3231_now(&t,NULL);
+	CHECK(same_time(&t,2099,12,31,23,59,59));
+	CHECK(reads==r);
+
+	chip_set_time(2100,1,1,5,0,0,0);
+	sqw_edge(TIMEBASE_CPU_HZ);
+	ds3231_now(&t,NULL);
+	CHECK(t.hours==0 && t.minutes==0 && t.seconds==0 && t.day==5);
+	ds3231_service();
+	ds3231_now(&t,NULL);
+	CHECK(same_time(&t,2100,1,1,0,0,0));
+	CHECK(reads==r+1);
+
+	// Borda perdida (2,5 s): o intervalo sai da faixa e o relogio e relido
+	chip_set_time(2100,1,1,5,0,0,3);
+	sqw_edge(TIMEBASE_CPU_HZ*5/2);
+	ds3231_service();
+	ds3231_now(&t,NULL);
+	CHECK(same_time(&t,2100,1,1,0,0,3));
+	CHECK(reads==r+2);
+}
+
+static void test_set_time(void)
+{
+	ds3231_time_t set={7,30,12,3,15,6,2150};
+	ds3231_snapshot_t snap;
+	uint32_t w=writes;
+
+	ds3231_set_time(&set);
+	CHECK(writes==w+1 && last_reg==DS3231_REG_SECONDS && last_len==7);
+	CHECK(chip[5]==(0x80|0x06) && chip[6]==0x50 && chip[2]==0x12);
+
+	ds3231_snapshot(&snap);
+	CHECK(same_time(&snap.time,2150,6,15,12,30,7) && snap.time.day==3);
+
+	// Modo 12 h gravado por outro programa: 11 PM
+	chip[2]=0x40|0x20|0x11;
+	ds3231_snapshot(&snap);
+	CHECK(snap.time.hours==23);
+	chip[2]=0x40|0x12;						// 12 AM = 0 h
+	ds3231_snapshot(&snap);
+	CHECK(snap.time.hours==0);
+}
+
+static void test_alarms(void)
+{
+	ds3231_snapshot_t snap;
+	ds3231_alarm_t a1={DS3231_ALARM_OFF,45,30,7,0};
+	ds3231_alarm_t a2={DS3231_ALARM_OFF,0,15,22,0};
+	static const ds3231_alarm_mode_t modes2[]={DS3231_ALARM_OFF,DS3231_ALARM_EVERY,DS3231_ALARM_MATCH_MS,
+			DS3231_ALARM_MATCH_HMS,DS3231_ALARM_MATCH_DATE,DS3231_ALARM_MATCH_DAY};
+
+	for(ds3231_alarm_mode_t m=DS3231_ALARM_OFF;m<=DS3231_ALARM_MATCH_DAY;m++)
+	{
+		uint32_t w=writes;
+
+		a1.mode=m;
+		a1.day_date=(m==DS3231_ALARM_MATCH_DAY)?6:28;
+		a2.mode=modes2[m%6];
+		a2.day_date=(a2.mode==DS3231_ALARM_MATCH_DAY)?2:17;
+		chip[DS3231_REG_STATUS]=DS3231_STAT_OSF|DS3231_STAT_A1F|DS3231_STAT_A2F;
+
+		ds3231_set_alarms(&a1,&a2,0);
+		CHECK(writes==w+1 && last_reg==DS3231_REG_ALARM1 && last_len==DS3231_REG_STATUS-DS3231_REG_ALARM1+1);
+		CHECK(chip[DS3231_REG_STATUS]==DS3231_STAT_OSF);	// flags de alarme apagadas, OSF mantido
+
+		ds3231_snapshot(&snap);
+		CHECK(snap.alarm1.mode==a1.mode && snap.alarm2.mode==a2.mode);
+		if(m==DS3231_ALARM_MATCH_DAY || m==DS3231_ALARM_MATCH_DATE)
+		{
+			CHECK(snap.alarm1.seconds==45 && snap.alarm1.minutes==30 && snap.alarm1.hours==7);
+			CHECK(snap.alarm1.day_date==a1.day_date);
+		}
+		if(a2.mode>=DS3231_ALARM_MATCH_DATE)
+		{
+			CHECK(snap.alarm2.minutes==15 && snap.alarm2.hours==22 && snap.alarm2.day_date==a2.day_date);
+		}
+	}
+
+	// Tabela 2 do datasheet: A1M1-A1M4 todos em 1 = todo segundo; DY/DT = 1 compara dia da semana
+	a1.mode=DS3231_ALARM_EVERY;
+	ds3231_set_alarms(&a1,NULL,0);
+	CHECK((chip[7]&chip[8]&chip[9]&chip[10]&0x80)==0x80);
+	a1.mode=DS3231_ALARM_MATCH_DAY;
+	a1.day_date=6;
+	ds3231_set_alarms(&a1,NULL,0);
+	CHECK(chip[10]==(0x40|6) && !((chip[7]|chip[8]|chip[9])&0x80));
+	CHECK(chip[DS3231_REG_CONTROL]&DS3231_CTRL_A1IE);
+
+	// So o alarme 2: a escrita comeca nele
+	ds3231_set_alarms(NULL,&a2,0);
+	CHECK(last_reg==DS3231_REG_ALARM2);
+}
+
+static uint8_t callback_flags;
+
+static void on_alarm(uint8_t flags)
+{
+	callback_flags|=flags;
+}
+
+/* Alarme com saida INT: a borda vira alarm_pending e o tratamento pelo I2C fica para ds3231_service() */
+static void test_alarm_interrupt(void)
+{
+	ds3231_alarm_t a1={DS3231_ALARM_MATCH_S,10,0,0,0};
+
+	ds3231_set_alarm_callback(on_alarm);
+	ds3231_set_alarms(&a1,NULL,1);
+	CHECK(chip[DS3231_REG_CONTROL]&DS3231_CTRL_INTCN);
+	ds3231_service();
+
+	chip[DS3231_REG_STATUS]|=DS3231_STAT_A1F;
+	sqw_edge(1000);
+	CHECK(callback_flags==0);
+	ds3231_service();
+	CHECK(callback_flags==DS3231_STAT_A1F);
+	CHECK(!(chip[DS3231_REG_STATUS]&DS3231_STAT_A1F));
+
+	ds3231_set_alarms(NULL,NULL,0);
+	CHECK(!(chip[DS3231_REG_CONTROL]&DS3231_CTRL_INTCN));
+}
+
+/* Temperatura em complemento de 2, 0,25 C por passo, inclusive entre -1 e 0 C */
+static void test_temperature(void)
+{
+	static const struct
+	{
+		uint8_t msb,lsb;
+		int16_t centi;
+	} cases[]={{0x19,0x00,2500},{0x19,0xC0,2575},{0x00,0x40,25},{0xFF,0xC0,-25},{0xFF,0x40,-75},{0xFF,0x00,-100},
+			{0xE7,0x40,-2475},{0x80,0x00,-12800},{0x7F,0xC0,12775}};
+	ds3231_snapshot_t snap;
+
+	for(unsigned i=0;i<sizeof(cases)/sizeof(cases[0]);i++)
+	{
+		uint32_t r=reads;
+		chip[DS3231_REG_TEMP_MSB]=cases[i].msb;
+		chip[DS3231_REG_TEMP_LSB]=cases[i].lsb;
+		CHECK(ds3231_temperature()==cases[i].centi);
+		CHECK(reads==r+1);
+		ds3231_snapshot(&snap);
+		CHECK(snap.temperature==cases[i].centi);
+	}
+}
+
+static void test_conversion_and_aging(void)
+{
+	uint32_t r=reads;
+	uint32_t w=writes;
+
+	chip[DS3231_REG_STATUS]=DS3231_STAT_BSY|DS3231_STAT_A2F;
+	CHECK(ds3231_start_conversion()==-1);
+	CHECK(reads==r+1 && writes==w);
+
+	// Ocupado: o aging e gravado sozinho e vale na proxima conversao automatica
+	CHECK(ds3231_set_aging(-5)==1);
+	CHECK(writes==w+1 && last_reg==DS3231_REG_AGING && last_len==1 && chip[DS3231_REG_AGING]==0xFB);
+
+	chip[DS3231_REG_STATUS]=DS3231_STAT_A2F;
+	r=reads;
+	w=writes;
+	CHECK(ds3231_set_aging(12)==0);
+	CHECK(reads==r+1 && writes==w+1 && last_reg==DS3231_REG_CONTROL && last_len==3);
+	CHECK(chip[DS3231_REG_AGING]==12 && (chip[DS3231_REG_CONTROL]&DS3231_CTRL_CONV));
+	CHECK(chip[DS3231_REG_STATUS]==DS3231_STAT_A2F);	// a escrita conjunta nao apaga flags
+
+	CHECK(ds3231_conversion_done()==0);
+	CHECK(ds3231_start_conversion()==-1);				// CONV ainda em 1
+	chip[DS3231_REG_CONTROL]&=~DS3231_CTRL_CONV;
+	CHECK(ds3231_conversion_done()==1);
+	w=writes;
+	CHECK(ds3231_start_conversion()==0);
+	CHECK(writes==w+1 && (chip[DS3231_REG_CONTROL]&DS3231_CTRL_CONV));
+}
+
+int main(void)
+{
+	test_init();
+	test_edges();
+	test_set_time();
+	test_alarms();
+	test_alarm_interrupt();
+	test_temperature();
+	test_conversion_and_aging();
+
+	printf("%s: %d falha(s), %u leituras e %u escritas no DS3231 simulado\n",failures?"FALHOU":"OK",failures,
+			(unsigned)reads,(unsigned)writes);
+	return failures?1:0;
+}
@@ -0,0 +1,148 @@
+/*
+ * Teste dos pools de blocos fixos e dos buffers de mensagem (Src/mempool.c) no PC.
+ *
+ * Confere a ordem de entrega dos blocos nunca usados, a reutilizacao pela lista livre, o pico e os contadores, que
+ * msg_alloc() passa para a classe seguinte sem contar falha e so conta uma quando todas estao esgotadas, que
+ * msg_free() acha a classe pelo endereco e que as variantes _isr devolvem o PRIMASK como estava.
+ *
+ * Compilar:  gcc -O2 -Wall -Wextra -I. -I../Inc -o test_mempool test_mempool.c sim_stm32.c ../Src/mempool.c
+ * Uso:       ./test_mempool   (retorna 0 se todos os testes passaram)
+ * */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "stm32f1xx.h"
+#include "mempool.h"
+
+static int failures;
+
+#define CHECK(cond)		check((cond),#cond,__LINE__)
+
+static void check(int ok, const char *what, int line)
+{
+	if(!ok)
+	{
+		printf("FALHOU linha %d: %s\n",line,what);
+		failures++;
+	}
+}
+
+MEMPOOL_DEFINE(test_pool,10,3);				// 10 bytes -> blocos de 12
+
+static void test_pool_basic(void)
+{
+	void *b[4];
+
+	CHECK(test_pool.block_size==12 && test_pool.count==3);
+	for(int i=0;i<3;i++)
+	{
+		b[i]=mempool_alloc(&test_pool);
+		CHECK(b[i]==(uint8_t *)test_pool.storage+12*i);
+		CHECK(((uintptr_t)b[i]&3U)==0);
+		CHECK(mempool_owns(&test_pool,b[i]));
+	}
+	CHECK(!mempool_owns(&test_pool,(uint8_t *)b[0]+4));
+	CHECK(!mempool_owns(&test_pool,(uint8_t *)b[2]+12));
+	b[3]=mempool_alloc(&test_pool);
+	CHECK(b[3]==NULL && test_pool.failures==1);
+	CHECK(test_pool.used==3 && test_pool.peak==3 && test_pool.allocs==3);
+
+	mempool_free(&test_pool,b[1]);
+	mempool_free(&test_pool,NULL);						// ignorado
+	CHECK(test_pool.used==2);
+	CHECK(mempool_alloc(&test_pool)==b[1]);				// volta pela lista livre
+	mempool_free(&test_pool,b[0]);
+	mempool_free(&test_pool,b[2]);
+	CHECK(mempool_alloc(&test_pool)==b[2]);				// ultimo liberado, primeiro entregue
+
+	mempool_reset_stats(&test_pool);
+	CHECK(test_pool.peak==test_pool.used && test_pool.allocs==0 && test_pool.failures==0);
+}
+
+static void test_isr_variants(void)
+{
+	MEMPOOL_DEFINE(isr_pool,4,1);
+
+	sim_primask=0;
+	void *b=mempool_alloc_isr(&isr_pool);
+	CHECK(b!=NULL && sim_primask==0);
+	mempool_free_isr(&isr_pool,b);
+	CHECK(sim_primask==0 && isr_pool.used==0);
+
+	// Chamada com as interrupcoes ja desligadas (de dentro de uma secao critica): continuam desligadas
+	sim_primask=1;
+	b=mempool_alloc_isr(&isr_pool);
+	CHECK(b!=NULL && sim_primask==1);
+	CHECK(mempool_alloc_isr(&isr_pool)==NULL && sim_primask==1);
+	mempool_free_isr(&isr_pool,b);
+	CHECK(sim_primask==1);
+	sim_primask=0;
+}
+
+static void test_messages(void)
+{
+	mempool_t *small=msg_pool(0);
+	mempool_t *medium=msg_pool(1);
+	mempool_t *large=msg_pool(2);
+	void *s[MSG_POOL_SMALL_COUNT];
+	void *m[MSG_POOL_MEDIUM_COUNT];
+
+	CHECK(msg_pool(MSG_POOLS)==NULL);
+	CHECK(small->block_size==MSG_POOL_SMALL_SIZE && medium->block_size==MSG_POOL_MEDIUM_SIZE &&
+			large->block_size==MSG_POOL_LARGE_SIZE);
+
+	// Cada pedido vai para a menor classe que cabe
+	void *a=msg_alloc(1);
+	void *b=msg_alloc(MSG_POOL_SMALL_SIZE+1U);
+	void *c=msg_alloc(MSG_POOL_LARGE_SIZE);
+	CHECK(mempool_owns(small,a) && mempool_owns(medium,b) && mempool_owns(large,c));
+	CHECK(msg_alloc(MSG_POOL_LARGE_SIZE+1U)==NULL);		// nenhuma classe cabe
+	msg_free(a);
+	msg_free(b);
+	msg_free(c);
+	CHECK(small->used==0 && medium->used==0 && large->used==0);
+
+	// Classe pequena esgotada: as seguintes atendem sem contar falha em nenhuma
+	for(unsigned i=0;i<MSG_POOL_SMALL_COUNT;i++)
+	{
+		s[i]=msg_alloc(8);
+		CHECK(s[i]!=NULL && mempool_owns(small,s[i]));
+	}
+	for(unsigned i=0;i<MSG_POOL_MEDIUM_COUNT;i++)
+	{
+		m[i]=msg_alloc(8);
+		CHECK(m[i]!=NULL && mempool_owns(medium,m[i]));
+	}
+	c=msg_alloc(8);
+	CHECK(c!=NULL && mempool_owns(large,c));
+	CHECK(small->failures==0 && medium->failures==0 && large->failures==0);
+
+	// Tudo esgotado: uma falha, na menor classe que caberia
+	CHECK(msg_alloc(8)==NULL);
+	CHECK(msg_alloc(MSG_POOL_SMALL_SIZE+1U)==NULL);
+	CHECK(small->failures==1 && medium->failures==1 && large->failures==0);
+	CHECK(small->peak==MSG_POOL_SMALL_COUNT && medium->peak==MSG_POOL_MEDIUM_COUNT && large->peak==1);
+	CHECK(sim_primask==0);
+
+	for(unsigned i=0;i<MSG_POOL_SMALL_COUNT;i++)
+	{
+		msg_free(s[i]);
+	}
+	for(unsigned i=0;i<MSG_POOL_MEDIUM_COUNT;i++)
+	{
+		msg_free(m[i]);
+	}
+	msg_free(c);
+	msg_free(NULL);
+	CHECK(small->used==0 && medium->used==0 && large->used==0);
+}
+
+int main(void)
+{
+	test_pool_basic();
+	test_isr_variants();
+	test_messages();
+
+	printf("%s: %d falha(s)\n",failures?"FALHOU":"OK",failures);
+	return failures?1:0;
+}
@@ -0,0 +1,332 @@
+/*
+ * Teste do driver do MPU-6050 (Src/mpu6050.c) no PC, contra um sensor e um barramento simulados.
+ *
+ * O sensor gera uma amostra por periodo: empilha os 12 bytes no FIFO de 1 KB (que transborda como o real) e pulsa o
+ * INT, ou seja, chama EXTI1_IRQHandler() com o DWT->CYCCNT de mentira no instante da amostra. As funcoes bloqueantes
+ * do I2C (usadas na configuracao) escrevem direto nos registradores do sensor; i2c_submit() so coloca a transferencia
+ * numa fila, que o laco de simulacao atende depois do tempo que ela levaria a 400 kHz, chamando a callback done como
+ * a interrupcao do I2C faria.
+ *
+ * As amostras levam o numero de sequencia no giroscopio X (41*n, que decodifica exatamente para 25*n decimos de dps),
+ * entao o teste confere ordem, perdas, decodificacao e carimbo de tempo de cada amostra entregue por mpu6050_read().
+ *
+ * Compilar:  gcc -O2 -Wall -Wextra -Wno-unused-parameter -I. -I../Inc -o test_mpu6050 test_mpu6050.c sim_stm32.c ../Src/mpu6050.c
+ * Uso:       ./test_mpu6050   (retorna 0 se todos os testes passaram)
+ * */
+
+#include <stdio.h>
+#include <string.h>
+#include "mpu6050.h"
+#include "timebase.h"
+
+void EXTI1_IRQHandler(void);
+
+static unsigned failures;
+
+#define CHECK(cond)		do { if(!(cond) && failures++<20) printf("FALHOU linha %d: %s\n",__LINE__,#cond); } while(0)
+
+/* ---------- MPU-6050 simulado ---------- */
+
+#define FIFO_SIZE		1024
+#define SAMPLE_BYTES	12
+#define SEQ_MOD			800				// 41*800 ainda cabe em int16_t
+
+static uint8_t regs[128];
+static uint8_t fifo[FIFO_SIZE];
+static uint16_t fifo_len;
+static uint32_t produced;				// amostras geradas pelo sensor
+static uint32_t sample_cycles[1u<<16];	// instante de cada amostra, pelo numero de sequencia
+
+/* Os drivers do barramento real (i2c.c) nao sao usados */
+i2c_bus_t i2c_bus1,i2c_bus2;
+
+static void sensor_write(uint8_t reg, uint8_t value)
+{
+	regs[reg]=value;
+	if(reg==MPU6050_REG_PWR_MGMT_1 && (value&0x80))
+	{
+		regs[reg]=0x40;								// depois do reset o sensor fica em SLEEP
+	}
+	if(reg==MPU6050_REG_USER_CTRL && (value&0x04))
+	{
+		fifo_len=0;									// FIFO_RESET
+		regs[reg]&=~0x04;
+	}
+}
+
+static void sensor_read(uint8_t reg, uint8_t *data, uint16_t length)
+{
+	if(reg==MPU6050_REG_FIFO_R_W)
+	{
+		// Leituras do FIFO nao avancam o endereco; alem do que ha no FIFO o sensor devolve 0xFF
+		for(uint16_t i=0;i<length;i++)
+		{
+			data[i]=(i<fifo_len)?fifo[i]:0xFF;
+		}
+		uint16_t n=(length<fifo_len)?length:fifo_len;
+		memmove(fifo,fifo+n,fifo_len-n);
+		fifo_len-=n;
+		return;
+	}
+	while(length--)
+	{
+		if(reg==MPU6050_REG_FIFO_COUNT)
+		{
+			*data++=(uint8_t)(fifo_len>>8);
+		}
+		else if(reg==MPU6050_REG_FIFO_COUNT+1)
+		{
+			*data++=(uint8_t)fifo_len;
+		}
+		else
+		{
+			*data++=regs[reg];
+		}
+		reg++;
+	}
+}
+
+static void put16(uint8_t *p, int16_t v)
+{
+	p[0]=(uint8_t)((uint16_t)v>>8);
+	p[1]=(uint8_t)v;
+}
+
+/* Uma amostra nova: acelerometro em (0.5 g, -1 g, 1 g), giroscopio X com o numero de sequencia */
+static void sensor_sample(void)
+{
+	uint8_t s[SAMPLE_BYTES];
+
+	put16(s+0,2048);
+	put16(s+2,-4096);
+	put16(s+4,4096);
+	put16(s+6,(int16_t)(41*(produced%SEQ_MOD)));
+	put16(s+8,-164);
+	put16(s+10,0);
+	sample_cycles[produced&0xFFFF]=DWT->CYCCNT;
+	produced++;
+
+	if(regs[MPU6050_REG_USER_CTRL]&0x40)
+	{
+		if(fifo_len+SAMPLE_BYTES>FIFO_SIZE)
+		{
+			// Transbordou: o sensor descarta os bytes mais antigos e o contador fica em 1024
+			uint16_t drop=fifo_len+SAMPLE_BYTES-FIFO_SIZE;
+			memmove(fifo,fifo+drop,fifo_len-drop);
+			fifo_len-=drop;
+		}
+		memcpy(fifo+fifo_len,s,SAMPLE_BYTES);
+		fifo_len+=SAMPLE_BYTES;
+	}
+	if(regs[MPU6050_REG_INT_ENABLE]&0x01)
+	{
+		EXTI1_IRQHandler();
+	}
+}
+
+/* ---------- barramento simulado ---------- */
+
+static i2c_xfer_t *queue_head;
+static i2c_xfer_t *queue_tail;
+static uint32_t busy_until;				// fim da transferencia na cabeca da fila
+static uint32_t submits;
+static uint32_t max_bytes;
+static int bus_stalled;
+
+void i2c_readMemoryByte(i2c_bus_t *bus, uint8_t saddr, uint8_t maddr, uint8_t *data)
+{
+	CHECK(queue_head==NULL);
+	sensor_read(maddr,data,1);
+}
+
+void i2c_MemoryWrite_Byte(i2c_bus_t *bus, uint8_t saddr, uint8_t maddr, uint8_t data)
+{
+	CHECK(queue_head==NULL);
+	sensor_write(maddr,data);
+}
+
+/* Duracao a 400 kHz: 9 bits por byte, mais endereco, registrador e START repetido */
+static uint32_t xfer_cycles(const i2c_xfer_t *x)
+{
+	return (uint32_t)(x->length+4)*9U*TIMEBASE_CPU_HZ/400000U;
+}
+
+void i2c_submit(i2c_bus_t *bus, i2c_xfer_t *xfer)
+{
+	CHECK(bus==&i2c_bus2 && xfer->saddr==MPU6050_ADDR);
+	for(i2c_xfer_t *q=queue_head;q;q=q->next)
+	{
+		CHECK(q!=xfer);						// a mesma estrutura duas vezes na fila estragaria a lista
+	}
+	submits++;
+	if(xfer->length>max_bytes)
+	{
+		max_bytes=xfer->length;
+	}
+	xfer->next=NULL;
+	xfer->status=I2C_XFER_QUEUED;
+	if(queue_head==NULL)
+	{
+		queue_head=xfer;
+		busy_until=DWT->CYCCNT+xfer_cycles(xfer);
+	}
+	else
+	{
+		queue_tail->next=xfer;
+	}
+	queue_tail=xfer;
+}
+
+/* Termina as transferencias cujo tempo ja passou, como a interrupcao do I2C */
+static void bus_run(void)
+{
+	while(queue_head && !bus_stalled && timebase_diff(DWT->CYCCNT,busy_until)>=0)
+	{
+		i2c_xfer_t *x=queue_head;
+		queue_head=x->next;
+		if(x->read)
+		{
+			sensor_read((uint8_t)x->reg,x->data,x->length);
+		}
+		else
+		{
+			for(uint16_t i=0;i<x->length;i++)
+			{
+				sensor_write((uint8_t)(x->reg+i),x->data[i]);
+			}
+		}
+		if(queue_head)
+		{
+			busy_until=DWT->CYCCNT+xfer_cycles(queue_head);
+		}
+		x->status=I2C_XFER_DONE;
+		if(x->done)
+		{
+			x->done(x);
+		}
+	}
+}
+
+/* ---------- testes ---------- */
+
+static uint32_t received;				// numero de sequencia da proxima amostra esperada
+static uint32_t period;
+static int resync;						// 1: a proxima amostra lida define a sequencia (depois de perdas)
+
+/* Avanca o tempo ms milissegundos em passos de 50 us, gerando as amostras e atendendo o barramento */
+static void run(uint32_t ms, int read)
+{
+	uint32_t step=50*TIMEBASE_CYCLES_PER_US;
+	uint32_t next=DWT->CYCCNT+period;
+
+	for(uint32_t t=0;t<ms*20;t++)
+	{
+		DWT->CYCCNT+=step;
+		if(timebase_diff(DWT->CYCCNT,next)>=0)
+		{
+			sensor_sample();
+			next+=period;
+		}
+		bus_run();
+
+		mpu6050_sample_t s;
+		while(read && mpu6050_read(&s))
+		{
+			if(resync)
+			{
+				// Procura a amostra pelo carimbo de tempo entre as ultimas geradas
+				for(received=produced-1;received>produced-1000 && sample_cycles[received&0xFFFF]!=s.timestamp;)
+				{
+					received--;
+				}
+				resync=0;
+			}
+			uint32_t seq=received%SEQ_MOD;
+			CHECK(s.gyro[0]==(int16_t)(25*seq));
+			CHECK(s.accel[0]==500 && s.accel[1]==-1000 && s.accel[2]==1000);
+			CHECK(s.gyro[1]==-100 && s.gyro[2]==0);
+			CHECK(s.timestamp==sample_cycles[received&0xFFFF]);
+			received++;
+		}
+	}
+}
+
+static void test_init(void)
+{
+	sim_dwt_step=TIMEBASE_CYCLES_PER_MS;			// a espera de 100 ms do reset termina em 100 leituras
+	regs[MPU6050_REG_WHO_AM_I]=0x00;
+	CHECK(mpu6050_init(&i2c_bus2,1000)==-1);
+	regs[MPU6050_REG_WHO_AM_I]=0x68;
+	CHECK(mpu6050_init(&i2c_bus2,3)==-1);
+	CHECK(mpu6050_init(&i2c_bus2,1001)==-1);
+
+	CHECK(mpu6050_init(&i2c_bus2,250)==0);
+	CHECK(regs[MPU6050_REG_SMPLRT_DIV]==3);
+	CHECK(mpu6050_init(&i2c_bus2,1000)==0);
+	CHECK(regs[MPU6050_REG_SMPLRT_DIV]==0);
+	CHECK(regs[MPU6050_REG_FIFO_EN]==0x78 && regs[MPU6050_REG_USER_CTRL]==0x40);
+	CHECK(regs[MPU6050_REG_INT_ENABLE]==0x01);
+	CHECK((EXTI->IMR&EXTI_IMR_MR1) && (EXTI->RTSR&EXTI_RTSR_RT1) && sim_irq_enabled[EXTI1_IRQn]);
+	sim_dwt_step=0;
+	period=TIMEBASE_CYCLES_PER_MS;
+}
+
+/* 1 kHz por 2 s: lotes de MPU6050_BATCH amostras, nenhuma perdida, cada uma com o carimbo da sua borda */
+static void test_stream(void)
+{
+	uint32_t p0=produced;
+
+	run(2000,1);
+	CHECK(mpu6050_dropped()==0);
+	CHECK(received>=produced-p0-MPU6050_BATCH-1 && received<=produced-p0);
+	CHECK(mpu6050_batches()>=190 && mpu6050_batches()<=200);
+	CHECK(submits<=2*mpu6050_batches()+2);		// FIFO_COUNT + FIFO_R_W por lote
+	CHECK(max_bytes<=MPU6050_MAX_BATCH*SAMPLE_BYTES);
+	printf("fluxo: %u amostras, %u lotes, %u transferencias\n",(unsigned)received,(unsigned)mpu6050_batches(),
+			(unsigned)submits);
+}
+
+/* Barramento parado por 200 ms: o FIFO do sensor transborda, e zerado e a leitura volta sozinha */
+static void test_overflow(void)
+{
+	uint32_t before;
+
+	bus_stalled=1;
+	run(200,1);
+	CHECK(fifo_len==FIFO_SIZE);
+	bus_stalled=0;
+	before=mpu6050_batches();
+	resync=1;
+	run(500,1);
+	CHECK(mpu6050_dropped()>=FIFO_SIZE/SAMPLE_BYTES);
+	CHECK(mpu6050_batches()>=before+45);
+	CHECK(resync==0 && received>=produced-MPU6050_BATCH-1);
+}
+
+/* Laco principal sem ler: a fila de MPU6050_RING amostras enche e o excesso e contado como perdido */
+static void test_ring_full(void)
+{
+	uint32_t dropped=mpu6050_dropped();
+	mpu6050_sample_t s;
+	uint32_t n=0;
+
+	run(200,0);
+	while(mpu6050_read(&s))
+	{
+		n++;
+	}
+	CHECK(n==MPU6050_RING-1);
+	CHECK(mpu6050_dropped()>dropped+100);
+}
+
+int main(void)
+{
+	test_init();
+	test_stream();
+	test_overflow();
+	test_ring_full();
+
+	printf("%s: %u falha(s), %u amostras geradas, %u perdidas\n",failures?"FALHOU":"OK",failures,(unsigned)produced,
+			(unsigned)mpu6050_dropped());
+	return failures?1:0;
+}
@@ -0,0 +1,160 @@
+/*
+ * Teste exaustivo da biblioteca de tempo (Src/timeconv.c) no PC, de 2000-01-01 a 2199-12-31 (a faixa do DS3231).
+ *
+ * Cada dia dos 200 anos e conferido contra um calendario de referencia que so soma um dia de cada vez (sem nenhuma
+ * formula em comum com timeconv.c) e contra timegm()/gmtime_r() da libc:
+ *  - days_from_civil() e civil_from_days() nos dois sentidos, e o dia da semana;
+ *  - time_to_epoch() e epoch_to_time() em todos os minutos do dia (com o segundo variando de um minuto para o
+ *    outro), e contra a libc no primeiro e no ultimo segundo do dia e em um segundo que varia;
+ *  - time_format_iso8601() contra snprintf().
+ * Os conversores BCD sao conferidos em todos os valores de 0 a 99 e em blocos de 1 a 16 bytes com todos os
+ * alinhamentos de inicio.
+ *
+ * Compilar:  gcc -O2 -Wall -Wextra -I. -I../Inc -o test_timeconv test_timeconv.c ../Src/timeconv.c
+ * Uso:       ./test_timeconv   (retorna 0 se todos os testes passaram)
+ * */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "timeconv.h"
+
+static unsigned failures;
+
+#define CHECK(cond)		do { if(!(cond) && failures++<20) printf("FALHOU linha %d: %s\n",__LINE__,#cond); } while(0)
+
+static int leap(unsigned y)
+{
+	return (y%4==0 && y%100!=0) || y%400==0;
+}
+
+static unsigned month_days(unsigned y, unsigned m)
+{
+	static const uint8_t days[12]={31,28,31,30,31,30,31,31,30,31,30,31};
+	return days[m-1]+(m==2 && leap(y));
+}
+
+static void test_bcd(void)
+{
+	uint8_t bin[20],bcd[20],out[20];
+
+	for(unsigned v=0;v<100;v++)
+	{
+		uint8_t b=(uint8_t)((v/10)<<4|(v%10));
+		CHECK(bin_to_bcd((uint8_t)v)==b);
+		CHECK(bcd_to_bin(b)==v);
+	}
+	for(unsigned len=1;len<=16;len++)
+	{
+		for(unsigned off=0;off<4;off++)
+		{
+			for(unsigned i=0;i<len;i++)
+			{
+				bin[off+i]=(uint8_t)((i*37+len*11+off)%100);
+			}
+			bcd_pack_block(bcd+off,bin+off,len);
+			bcd_unpack_block(out+off,bcd+off,len);
+			for(unsigned i=0;i<len;i++)
+			{
+				CHECK(bcd[off+i]==bin_to_bcd(bin[off+i]));
+				CHECK(out[off+i]==bin[off+i]);
+			}
+			bcd_unpack_block(bcd+off,bcd+off,len);		// no lugar
+			CHECK(memcmp(bcd+off,bin+off,len)==0);
+		}
+	}
+}
+
+static void check_second(const ds3231_time_t *ref, uint32_t sod)
+{
+	ds3231_time_t t=*ref;
+	ds3231_time_t back;
+	struct tm tm={0};
+	char iso[TIME_ISO8601_LEN];
+	char expect[32];
+
+	t.hours=(uint8_t)(sod/3600);
+	t.minutes=(uint8_t)(sod/60%60);
+	t.seconds=(uint8_t)(sod%60);
+
+	tm.tm_year=t.year-1900;
+	tm.tm_mon=t.month-1;
+	tm.tm_mday=t.date;
+	tm.tm_hour=t.hours;
+	tm.tm_min=t.minutes;
+	tm.tm_sec=t.seconds;
+	uint64_t epoch=time_to_epoch(&t);
+	CHECK(epoch==(uint64_t)timegm(&tm));
+
+	memset(&back,0xAA,sizeof(back));
+	epoch_to_time(epoch,&back);
+	CHECK(memcmp(&back,&t,sizeof(t))==0);
+
+	CHECK(time_format_iso8601(iso,&t)==TIME_ISO8601_LEN-1);
+	snprintf(expect,sizeof(expect),"%04u-%02u-%02uT%02u:%02u:%02uZ",t.year,t.month,t.date,t.hours,t.minutes,t.seconds);
+	CHECK(strcmp(iso,expect)==0);
+}
+
+static unsigned test_calendar(void)
+{
+	ds3231_time_t ref={0,0,0,6,1,1,2000};		// 2000-01-01 foi um sabado
+	int32_t days=days_from_civil(2000,1,1);
+	unsigned count=0;
+
+	CHECK(days==10957);
+	while(ref.year<2200)
+	{
+		uint16_t y;
+		uint8_t m,d;
+
+		CHECK(days_from_civil(ref.year,ref.month,ref.date)==days);
+		civil_from_days(days,&y,&m,&d);
+		CHECK(y==ref.year && m==ref.month && d==ref.date);
+
+		time_t tt=(time_t)days*86400;
+		struct tm tm;
+		gmtime_r(&tt,&tm);
+		CHECK(tm.tm_year+1900==ref.year && tm.tm_mon+1==ref.month && tm.tm_mday==ref.date);
+		CHECK((tm.tm_wday?tm.tm_wday:7)==ref.day);
+
+		for(uint32_t min=0;min<1440;min++)
+		{
+			ds3231_time_t t=ref;
+			ds3231_time_t back;
+			t.hours=(uint8_t)(min/60);
+			t.minutes=(uint8_t)(min%60);
+			t.seconds=(uint8_t)((min+count)%60);
+			epoch_to_time(time_to_epoch(&t),&back);
+			CHECK(memcmp(&back,&t,sizeof(t))==0);
+		}
+		check_second(&ref,0);
+		check_second(&ref,86399);
+		check_second(&ref,(uint32_t)(count*7919U)%86400U);
+
+		// Dia seguinte no calendario de referencia
+		ref.day=ref.day%7+1;
+		if(++ref.date>month_days(ref.year,ref.month))
+		{
+			ref.date=1;
+			if(++ref.month>12)
+			{
+				ref.month=1;
+				ref.year++;
+			}
+		}
+		days++;
+		count++;
+	}
+	CHECK(count==73049);
+	return count;
+}
+
+int main(void)
+{
+	test_bcd();
+	unsigned n=test_calendar();
+
+	printf("%s: %u falha(s), %u dias conferidos\n",failures?"FALHOU":"OK",failures,n);
+	return failures?1:0;
+}
@@ -23,23 +23,24 @@
 #endif
 
 #include "stm32f1xx.h"
+#include "bitband.h"
+
+// Flags de um bit em bitband_flags
+#define FLAG_SYSTICK_TASK	0
+
+BITBAND_FLAGS_DEFINE;
 
-int SysTick_TASK = 0;
 void SysTick_Handler(void)
 {
-	// Do stuff
-	SysTick_TASK = 1;
+	// Do stuff (um unico STR no alias da flag)
+	BITBAND_FLAG(FLAG_SYSTICK_TASK) = 1;
 }
 void setLEDs(uint8_t r, uint8_t g, uint8_t b)
 {
-    if (r) GPIOB->ODR |= (1 << 8);
-    else GPIOB->ODR &= ~(1 << 8);
-
-    if (g) GPIOB->ODR |= (1 << 10);
-    else GPIOB->ODR &= ~(1 << 10);
-
-    if (b) GPIOB->ODR |= (1 << 9);
-    else GPIOB->ODR &= ~(1 << 9);
+    // Cada pino do ODR e escrito pelo seu alias de bit-band, sem ler o registrador
+    BITBAND_REG(GPIOB->ODR, 8) = r;
+    BITBAND_REG(GPIOB->ODR, 10) = g;
+    BITBAND_REG(GPIOB->ODR, 9) = b;
 }
 
 
@@ -148,9 +149,9 @@ int main(void)
 
     for(;;)
     {
-        if (SysTick_TASK)
+        if (BITBAND_FLAG(FLAG_SYSTICK_TASK))
         {
-            SysTick_TASK = 0;
+            BITBAND_FLAG(FLAG_SYSTICK_TASK) = 0;
 
             setLEDs(states[currentState][0], states[currentState][1], states[currentState][2]);
 
@@ -0,0 +1,39 @@
+#ifndef BITBAND_H_
+#define BITBAND_H_
+
+#include "stdint.h"
+
+/*
+ * Acesso a bits individuais pelo bit-band do Cortex-M3.
+ *
+ * Cada bit do primeiro 1 MB da SRAM (0x20000000) e dos perifericos (0x40000000) aparece como uma palavra na regiao
+ * de alias (0x22000000 e 0x42000000): ler a palavra devolve o bit (0 ou 1) e escrever nela altera so aquele bit.
+ * A escrita e um unico STR e a leitura-modificacao-escrita e feita pelo barramento sem poder ser interrompida, entao
+ * uma ISR que mexa em outro bit da mesma palavra nao perde a sua alteracao, como acontece com "x |= bit".
+ *
+ * O endereco de alias e calculado pelo compilador quando o endereco do alvo e constante: registradores de
+ * periferico (&TIM3->DIER) e as flags em bitband_flags, que o linker script fixa no inicio da RAM.
+ *
+ * Nao use a escrita por bit-band em registradores de status cujos bits sao limpos escrevendo 0 (rc_w0, como
+ * TIMx_SR e USART_SR): o barramento regrava a palavra lida e apaga uma flag que o hardware ative entre a leitura e
+ * a escrita. Para esses a forma correta ja e uma escrita unica com o bit em 0 e os outros em 1 (TIM3->SR = ~UIF).
+ * A leitura por bit-band desses registradores nao tem esse problema.
+ * */
+
+#define BITBAND_ALIAS(addr,bit)	((((uint32_t)(addr))&0xF0000000U)+0x02000000U+((((uint32_t)(addr))&0x000FFFFFU)<<5)+((uint32_t)(bit)<<2))
+#define BITBAND(addr,bit)		(*(volatile uint32_t *)BITBAND_ALIAS(addr,bit))
+
+/* Bit de um registrador de periferico: BITBAND_REG(TIM3->DIER, TIM_DIER_UIE_Pos) = 1; */
+#define BITBAND_REG(reg,bit)	BITBAND(&(reg),bit)
+
+/*
+ * Flags de um bit entre ISRs e o laco principal. Cada projeto define a palavra uma unica vez com BITBAND_FLAGS_DEFINE
+ * e numera as suas flags (0 a 31); BITBAND_FLAG(n) e um lvalue que le ou escreve so o bit n.
+ * */
+#define BITBAND_FLAGS_ADDR		0x20000000U
+#define BITBAND_FLAGS_DEFINE	volatile uint32_t bitband_flags __attribute__((section(".bitband")))
+#define BITBAND_FLAG(n)			BITBAND(BITBAND_FLAGS_ADDR,n)
+
+extern volatile uint32_t bitband_flags;
+
+#endif /* BITBAND_H_ */
@@ -0,0 +1,21 @@
+#ifndef SWPWM_H_
+#define SWPWM_H_
+
+#include "stdint.h"
+#include "stm32f1xx.h"
+
+/*
+ * Resolucao (bits por duty) e duracao do bit menos significativo em ciclos do TIM4 (8 MHz). O quadro dura
+ * (2^SWPWM_BITS - 1) * SWPWM_BASE_TICKS ciclos: 255 * 32 / 8 MHz = 1,02 ms, ou ~980 Hz.
+ * SWPWM_BASE_TICKS precisa cobrir as duas transferencias de DMA de cada fatia (BSRR e ARR).
+ * */
+#define SWPWM_BITS			8U
+#define SWPWM_BASE_TICKS	32U
+#define SWPWM_MAX			((1U<<SWPWM_BITS)-1U)
+
+void swpwm_init(GPIO_TypeDef *port, uint16_t pins);
+void swpwm_set(uint8_t pin, uint16_t duty);
+void swpwm_commit(void);
+uint32_t swpwm_frames(void);
+
+#endif /* SWPWM_H_ */
@@ -52,21 +52,43 @@
 #endif
 
 #include "stm32f1xx.h"
+#include "bitband.h"
+#include "gpio.h"
+#include "swpwm.h"
 
 #define BLINK_INTERVAL_MS 10
 
-volatile uint8_t timerInterruptFlag = 0;
+/* Saidas do PWM por software (BAM por DMA no BSRR), livres dos canais fixos dos timers */
+#define SW_LED1	(B, 12, GPIO_OUT_PP_10MHZ)
+#define SW_LED2	(B, 13, GPIO_OUT_PP_10MHZ)
+#define SW_LED3	(B, 14, GPIO_OUT_PP_10MHZ)
+#define SW_LED4	(B, 15, GPIO_OUT_PP_10MHZ)
+#define SW_PINS	(GPIO_MASK(SW_LED1) | GPIO_MASK(SW_LED2) | GPIO_MASK(SW_LED3) | GPIO_MASK(SW_LED4))
+
+/* Canais 1 a 3 do TIM2 sem remapeamento */
+#define PWM_CH1	(A, 0, GPIO_AF_PP_50MHZ)
+#define PWM_CH2	(A, 1, GPIO_AF_PP_50MHZ)
+#define PWM_CH3	(A, 2, GPIO_AF_PP_50MHZ)
+
+GPIO_ASSERT_DISTINCT(PWM_CH1, PWM_CH2, PWM_CH3, SW_LED1, SW_LED2, SW_LED3, SW_LED4);
+
+// Flags de um bit em bitband_flags
+#define FLAG_TIMER_INTERRUPT	0
+
+BITBAND_FLAGS_DEFINE;
 volatile uint8_t increasing = 1;  // Flag para indicar se o duty cycle está aumentando ou diminuindo
 volatile uint16_t pwmValue = 0;   // Valor atual do PWM
 
 void TIM3_IRQHandler(void)
 {
-    if (TIM3->SR & TIM_SR_UIF)
+    if (BITBAND_REG(TIM3->SR, TIM_SR_UIF_Pos))
     {
-        TIM3->SR &= ~TIM_SR_UIF;
+        // UIF e rc_w0: escrever 1 nos outros bits nao altera nada, entao uma escrita simples limpa so o UIF
+        // (o "&=" podia apagar uma flag ativada entre a leitura e a escrita)
+        TIM3->SR = ~TIM_SR_UIF;
 
         // Define a flag de interrupção
-        timerInterruptFlag = 1;
+        BITBAND_FLAG(FLAG_TIMER_INTERRUPT) = 1;
     }
 }
 
@@ -91,20 +113,8 @@ int main(void)
 	*/
 	// OUTPUT
 
-	/*Configure PA0 as Output Alternate Push/Pull */
-	GPIOA->CRL|=GPIO_CRL_MODE0;
-	GPIOA->CRL|=(GPIO_CRL_CNF0_1);
-	GPIOA->CRL&=~(GPIO_CRL_CNF0_0);
-
-	// PA1
-	GPIOA->CRL |= GPIO_CRL_MODE1;
-	GPIOA->CRL |= (GPIO_CRL_CNF1_1);
-	GPIOA->CRL &= ~(GPIO_CRL_CNF1_0);
-
-	// PA2
-	GPIOA->CRL |= GPIO_CRL_MODE2;
-	GPIOA->CRL |= (GPIO_CRL_CNF2_1);
-	GPIOA->CRL &= ~(GPIO_CRL_CNF2_0);
+	/*Configure PA0, PA1 e PA2 as Output Alternate Push/Pull, 50 MHz */
+	GPIO_CONFIG(A, PWM_CH1, PWM_CH2, PWM_CH3);
 
 /*******************************************************************************************************************
  * 												PWM
@@ -191,13 +201,22 @@ int main(void)
     // Inicia o Timer2
     TIM3->CR1 |= TIM_CR1_CEN;
 
+	/*******************************************************************************************************************
+	 * 											  	PWM por software
+	 * *****************************************************************************************************************
+	 * PB12 a PB15 recebem PWM de 8 bits pelo TIM4 + DMA; cada LED respira com a fase deslocada de 1/4.
+	 * */
+    GPIO_CONFIG(B, SW_LED1, SW_LED2, SW_LED3, SW_LED4);
+    swpwm_init(GPIOB, SW_PINS);
+    uint8_t swPhase = 0;
+
     int ledIndex = 0;  // Variável para controlar qual LED está ativo
 
     while(1)
     {
-        if (timerInterruptFlag)
+        if (BITBAND_FLAG(FLAG_TIMER_INTERRUPT))
         {
-            timerInterruptFlag = 0;
+            BITBAND_FLAG(FLAG_TIMER_INTERRUPT) = 0;
 
             // Controle do PWM para o LED atual
             if (increasing)
@@ -237,6 +256,15 @@ int main(void)
                     TIM2->CCR3 = pwmValue;
                     break;
             }
+
+            // Onda triangular de 0 a SWPWM_MAX em 256 passos de 10 ms, uma fase por LED
+            swPhase++;
+            for (uint8_t i = 0; i < 4; i++)
+            {
+                uint8_t t = (uint8_t)(swPhase + i * 64);
+                swpwm_set(12 + i, t < 128 ? t * 2 : (255 - t) * 2);
+            }
+            swpwm_commit();
         }
     }
 
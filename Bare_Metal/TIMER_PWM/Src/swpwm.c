@@ -0,0 +1,139 @@
+#include "swpwm.h"
+
+/*
+ * PWM por software com modulacao por angulo de bit (BAM) em ate 16 pinos de uma porta.
+ *
+ * O quadro tem SWPWM_BITS fatias; a fatia b dura SWPWM_BASE_TICKS << b e, durante ela, cada pino fica no valor do
+ * bit b do seu duty. A media no quadro e exatamente duty / SWPWM_MAX, com uma escrita por fatia (8 por quadro) em vez
+ * de uma por passo de resolucao (255).
+ *
+ * Cada fatia e uma palavra de BSRR pre-calculada (liga os pinos com o bit em 1 e desliga os com o bit em 0, sem
+ * tocar nos demais pinos da porta). No TIM4:
+ * 	- o evento de atualizacao (inicio da fatia) pede ao DMA1 canal 7 a proxima palavra para o BSRR;
+ * 	- o compare 1, em CNT = 1, pede ao DMA1 canal 1 a duracao da fatia seguinte para o ARR, que com o ARPE ligado
+ * 	  so vale a partir da proxima atualizacao.
+ * Os dois canais sao circulares, entao as bordas saem no tempo do timer sem nenhuma interrupcao por fatia.
+ *
+ * A tabela de BSRR tem dois quadros. A interrupcao de meio/fim de transferencia avisa qual quadro acabou de sair;
+ * se houver duties novos (swpwm_commit), so esse quadro livre e recalculado. A troca acontece sempre na fronteira
+ * entre quadros e nunca no meio de um.
+ * */
+
+static uint32_t frame[2][SWPWM_BITS];
+static uint16_t slot_arr[SWPWM_BITS];
+static uint16_t duty_next[16];
+static uint16_t duty_shadow[16];
+static uint16_t pin_mask;
+static volatile uint8_t stale;		// quadros ainda com os duties antigos
+static volatile uint32_t frames;
+
+static void swpwm_build(uint32_t *f)
+{
+	for(uint32_t b=0;b<SWPWM_BITS;b++)
+	{
+		uint32_t set=0;
+		uint32_t pins=pin_mask;
+		while(pins)
+		{
+			uint32_t p=31U-__CLZ(pins);
+			pins&=~(1UL<<p);
+			set|=((duty_shadow[p]>>b)&1U)<<p;
+		}
+		f[b]=set|((pin_mask&~set)<<16);
+	}
+}
+
+/*
+ * Inicia o PWM nos pinos (mascara) de port com duty 0. Os pinos ja devem estar configurados como saida.
+ * Usa o TIM4 e os canais 1 e 7 do DMA1.
+ * */
+void swpwm_init(GPIO_TypeDef *port, uint16_t pins)
+{
+	pin_mask=pins;
+	for(uint32_t p=0;p<16;p++)
+	{
+		duty_next[p]=duty_shadow[p]=0;
+	}
+	swpwm_build(frame[0]);
+	swpwm_build(frame[1]);
+	stale=0;
+	frames=0;
+
+	// A fatia k escreve no ARR a duracao da fatia k+1
+	for(uint32_t b=0;b<SWPWM_BITS;b++)
+	{
+		slot_arr[b]=(uint16_t)((SWPWM_BASE_TICKS<<((b+1)%SWPWM_BITS))-1U);
+	}
+
+	RCC->AHBENR|=RCC_AHBENR_DMA1EN;
+	RCC->APB1ENR|=RCC_APB1ENR_TIM4EN;
+
+	TIM4->CR1=TIM_CR1_ARPE;
+	TIM4->PSC=0;
+	TIM4->ARR=SWPWM_BASE_TICKS-1U;
+	TIM4->CCR1=1;
+	TIM4->CNT=0;
+
+	// DMA1 canal 7 (TIM4_UP): frame -> BSRR, circular nos dois quadros, interrupcao a cada quadro
+	DMA1_Channel7->CCR=0;
+	DMA1_Channel7->CPAR=(uint32_t)&port->BSRR;
+	DMA1_Channel7->CMAR=(uint32_t)frame;
+	DMA1_Channel7->CNDTR=2*SWPWM_BITS;
+	DMA1_Channel7->CCR=DMA_CCR_PL|DMA_CCR_MSIZE_1|DMA_CCR_PSIZE_1|DMA_CCR_MINC|DMA_CCR_CIRC|DMA_CCR_DIR
+			|DMA_CCR_HTIE|DMA_CCR_TCIE|DMA_CCR_EN;
+
+	// DMA1 canal 1 (TIM4_CH1): slot_arr -> ARR, circular
+	DMA1_Channel1->CCR=0;
+	DMA1_Channel1->CPAR=(uint32_t)&TIM4->ARR;
+	DMA1_Channel1->CMAR=(uint32_t)slot_arr;
+	DMA1_Channel1->CNDTR=SWPWM_BITS;
+	DMA1_Channel1->CCR=DMA_CCR_PL|DMA_CCR_MSIZE_0|DMA_CCR_PSIZE_0|DMA_CCR_MINC|DMA_CCR_CIRC|DMA_CCR_DIR|DMA_CCR_EN;
+
+	NVIC_EnableIRQ(DMA1_Channel7_IRQn);
+
+	// O UG carrega o ARR da fatia 0 e ja pede a primeira palavra de BSRR; dai em diante o timer conduz tudo
+	TIM4->DIER=TIM_DIER_UDE|TIM_DIER_CC1DE;
+	TIM4->EGR=TIM_EGR_UG;
+	TIM4->CR1|=TIM_CR1_CEN;
+}
+
+/* Duty do pino (0 a SWPWM_MAX). So vale depois de swpwm_commit(). */
+void swpwm_set(uint8_t pin, uint16_t duty)
+{
+	if(pin<16)
+	{
+		duty_next[pin]=duty>SWPWM_MAX?SWPWM_MAX:duty;
+	}
+}
+
+/* Publica todos os duties de swpwm_set() de uma vez; eles entram juntos no proximo quadro livre */
+void swpwm_commit(void)
+{
+	NVIC_DisableIRQ(DMA1_Channel7_IRQn);
+	for(uint32_t p=0;p<16;p++)
+	{
+		duty_shadow[p]=duty_next[p];
+	}
+	stale=2;
+	NVIC_EnableIRQ(DMA1_Channel7_IRQn);
+}
+
+/* Quadros gerados desde swpwm_init() */
+uint32_t swpwm_frames(void)
+{
+	return frames;
+}
+
+void DMA1_Channel7_IRQHandler(void)
+{
+	uint32_t isr=DMA1->ISR;
+
+	DMA1->IFCR=DMA_IFCR_CGIF7;
+	frames++;
+	if(stale)
+	{
+		// HT: o quadro 0 ja foi todo escrito no BSRR e o DMA esta no quadro 1 (TC: o contrario)
+		swpwm_build(frame[(isr&DMA_ISR_TCIF7)?1:0]);
+		stale--;
+	}
+}
@@ -1,13 +1,26 @@
 #include <stdint.h>
 #include "stm32f1xx.h"
+#include "gpio.h"
+#include "bitband.h"
 #include <stdlib.h>  // Para usar a função atoi()
 
 #define CPU_CLK 	8000000
 #define BaudRate	115200
 
+/* LEDs RGB (pinos dos canais 1, 2 e 4 do TIM4) e entrada RX do USART1 */
+#define LED_RED		(B, 6, GPIO_OUT_PP_2MHZ)
+#define LED_GREEN	(B, 7, GPIO_OUT_PP_2MHZ)
+#define LED_BLUE	(B, 9, GPIO_OUT_PP_2MHZ)
+#define USART1_RX	(A, 10, GPIO_IN_FLOAT)
+
+GPIO_ASSERT_DISTINCT(LED_RED, LED_GREEN, LED_BLUE, USART1_RX);
+
 char rx_buffer[3];  // Buffer para armazenar três caracteres
 char* rx_ptr = rx_buffer;  // Ponteiro para o buffer
-uint8_t MAIN_SM = 0;
+// Flags de um bit em bitband_flags
+#define FLAG_RX_COMMAND	0  // comando completo no rx_buffer
+
+BITBAND_FLAGS_DEFINE;
 uint8_t toggle_mode = 0;  // Variável para controlar o estado do toggle (0 = desligado, 1 = ligado)
 uint8_t current_color = 0;  // Variável para controlar a cor atual no modo toggle
 
@@ -20,7 +33,7 @@ int convert_intensity(char tens, char units) {
 void USART1_IRQHandler(void)
 {
     /* Verifica se há um dado recebido */
-    if ((USART1->SR & USART_SR_RXNE))
+    if (BITBAND_REG(USART1->SR, USART_SR_RXNE_Pos))
     {
         /* Lê o dado recebido */
         char received_char = USART1->DR;
@@ -40,7 +53,7 @@ void USART1_IRQHandler(void)
         if (rx_ptr >= (rx_buffer + 3))
         {
             rx_ptr = rx_buffer;  // Reinicia o ponteiro
-            MAIN_SM = 1;         // Sinaliza que o comando está completo
+            BITBAND_FLAG(FLAG_RX_COMMAND) = 1;  // Sinaliza que o comando está completo
         }
     }
 }
@@ -48,18 +61,18 @@ void USART1_IRQHandler(void)
 void toggle_colors(void) {
     switch (current_color) {
         case 0:  // Vermelho
-            GPIOB->ODR |= 0x00000040;  // Liga o LED vermelho (PB6)
-            GPIOB->ODR &= ~(0x00000080 | 0x00000200);  // Desliga os outros
+            // Liga o LED vermelho (PB6) e desliga os outros em uma unica escrita
+            GPIOB->BSRR = GPIO_BSRR_SET(LED_RED) | GPIO_BSRR_RESET(LED_GREEN) | GPIO_BSRR_RESET(LED_BLUE);
             current_color = 1;  // Muda para verde na próxima iteração
             break;
         case 1:  // Verde
-            GPIOB->ODR |= 0x00000080;  // Liga o LED verde (PB7)
-            GPIOB->ODR &= ~(0x00000040 | 0x00000200);  // Desliga os outros
+            // Liga o LED verde (PB7) e desliga os outros
+            GPIOB->BSRR = GPIO_BSRR_SET(LED_GREEN) | GPIO_BSRR_RESET(LED_RED) | GPIO_BSRR_RESET(LED_BLUE);
             current_color = 2;  // Muda para azul na próxima iteração
             break;
         case 2:  // Azul
-            GPIOB->ODR |= 0x00000200;  // Liga o LED azul (PB9)
-            GPIOB->ODR &= ~(0x00000040 | 0x00000080);  // Desliga os outros
+            // Liga o LED azul (PB9) e desliga os outros
+            GPIOB->BSRR = GPIO_BSRR_SET(LED_BLUE) | GPIO_BSRR_RESET(LED_RED) | GPIO_BSRR_RESET(LED_GREEN);
             current_color = 0;  // Muda para vermelho na próxima iteração
             break;
     }
@@ -68,18 +81,12 @@ void toggle_colors(void) {
 
 int main(void)
 {
-	//enable clock access to GPIOA
-	RCC->APB2ENR|=RCC_APB2ENR_IOPAEN;
-	//enable clock access to GPIOB
-	RCC->APB2ENR|=RCC_APB2ENR_IOPBEN;
-
 	//Enable clock access to alternate function
 	RCC->APB2ENR|=RCC_APB2ENR_AFIOEN;
 
 	// Rx
-	//Configure PA10(RX) as input floating
-	GPIOA->CRH &= 0xFFFFF0FF;
-	GPIOA->CRH |= 0x00000400;
+	//Configure PA10(RX) as input floating (also enables clock access to GPIOA)
+	GPIO_CONFIG(A, USART1_RX);
 
 	/**************************************************************************************
 	 *
@@ -113,12 +120,9 @@ int main(void)
 	// Habilitar o clock para GPIOB e TIM4
 	RCC->APB1ENR |= RCC_APB1ENR_TIM4EN;   // Habilita o clock para TIM4
 	// Configura PB6, PB7, PB9 como saída alternativa push-pull para os LEDs (TIM4 channels)
-	GPIOB->CRL &= 0x00FFFFFF;
-	GPIOB->CRL |= 0x22000000;
-	GPIOB->CRH &= 0xFFFFFF00;
-	GPIOB->CRH |= 0x00000022;
+	GPIO_CONFIG(B, LED_RED, LED_GREEN, LED_BLUE);
 
-	GPIOB->ODR &= 0x00000000;
+	GPIOB->BRR = GPIO_MASK(LED_RED) | GPIO_MASK(LED_GREEN) | GPIO_MASK(LED_BLUE);
 	// Configurar TIM4 para gerar PWM
 	TIM4->PSC = 799;   // Define o prescaler como 0 (sem divisão, frequência máxima)
 	TIM4->ARR = 99;  // Define o valor máximo do contador para 100 (para PWM de 0 a 100%)
@@ -138,9 +142,9 @@ int main(void)
 
     while(1)
     {
-        if(MAIN_SM)
+        if(BITBAND_FLAG(FLAG_RX_COMMAND))
         {
-            MAIN_SM = 0;  // Reseta o estado da máquina
+            BITBAND_FLAG(FLAG_RX_COMMAND) = 0;  // Reseta o estado da máquina
 
             // Verifica se todos os três caracteres foram recebidos corretamente
             char tens = rx_buffer[1];   // Segundo caractere é a dezena
@@ -158,31 +162,19 @@ int main(void)
                 case 'R':
                 case 'r':
                     TIM4->CCR1 = convert_intensity(tens, units);
-                    if (TIM4->CCR1 > 0) {
-                        GPIOB->ODR |= 0x00000040;  // Liga o LED vermelho (PB6)
-                    } else {
-                        GPIOB->ODR &= ~0x00000040;  // Desliga o LED vermelho (PB6)
-                    }
+                    GPIO_WRITE(LED_RED, TIM4->CCR1 > 0);  // Liga ou desliga o LED vermelho (PB6)
                     break;
 
                 case 'G':
                 case 'g':
                     TIM4->CCR2 = convert_intensity(tens, units);
-                    if (TIM4->CCR2 > 0) {
-                        GPIOB->ODR |= 0x00000080;  // Liga o LED verde (PB7)
-                    } else {
-                        GPIOB->ODR &= ~0x00000080;  // Desliga o LED verde (PB7)
-                    }
+                    GPIO_WRITE(LED_GREEN, TIM4->CCR2 > 0);  // Liga ou desliga o LED verde (PB7)
                     break;
 
                 case 'B':
                 case 'b':
                     TIM4->CCR4 = convert_intensity(tens, units);
-                    if (TIM4->CCR4 > 0) {
-                        GPIOB->ODR |= 0x00000200;  // Liga o LED azul (PB9)
-                    } else {
-                        GPIOB->ODR &= ~0x00000200;  // Desliga o LED azul (PB9)
-                    }
+                    GPIO_WRITE(LED_BLUE, TIM4->CCR4 > 0);  // Liga ou desliga o LED azul (PB9)
                     break;
 
                 default: